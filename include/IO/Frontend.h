@@ -0,0 +1,89 @@
+#ifndef FRONTEND_H
+#define FRONTEND_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "IO/Joypad.h"
+
+/**
+* Abstract video, audio and
+* input sink of the emulator.
+* The emulation core only talks
+* to this interface, so it can
+* be driven by an application
+* window as well as by a headless
+* frontend that discards the output.
+*
+* @see Window
+* @see NullFrontend
+*/
+class Frontend {
+public:
+
+    /**
+    * Class destructor.
+    */
+    virtual ~Frontend(void) = default;
+
+    /**
+    * Connects the joypads that
+    * will receive the user input.
+    *
+    * @param joypads array of two
+    *   joypads
+    *
+    * @see Joypad
+    */
+    virtual void connectJoypads(Joypad* joypads) = 0;
+
+    /**
+    * Returns the information if the
+    * frontend still accepts output.
+    * The emulation stops once it
+    * returns false.
+    *
+    * @return true if the frontend
+    *   is open
+    */
+    virtual bool isOpen(void) = 0;
+
+    /**
+    * Queues the audio samples
+    * generated during a frame
+    * for playback.
+    *
+    * @param samples mono 16 bit
+    *   audio samples
+    * @param sampleCount number of
+    *   samples
+    */
+    virtual void queueAudio(const int16_t* samples, const size_t& sampleCount) = 0;
+
+    /**
+    * Returns the ratio the audio
+    * sample rate should be adjusted
+    * by, so the queued audio stays
+    * at a steady level, e.g. 1.001
+    * asks for 0.1% more samples.
+    *
+    * @return sample rate ratio
+    */
+    virtual double getSampleRateRatio(void) = 0;
+
+    /**
+    * Displays the freshly
+    * generated frame.
+    *
+    * @param frameBuffer 256x240 packed
+    *   RGBA pixels, row by row
+    * @param frameHash hash of the 
+    *   pixels, equal for equal frames
+    *
+    * @see Colour::rgba
+    */
+    virtual void swapBuffers(const uint32_t* frameBuffer, const uint64_t& frameHash) = 0;
+
+};
+
+#endif // !FRONTEND_H
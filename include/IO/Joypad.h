@@ -1,6 +1,7 @@
 #ifndef JOYPAD_H
 #define JOYPAD_H
 
+#include <atomic>
 #include <cstdint>
 
 /**
@@ -69,8 +70,8 @@ public:
     * @see mState
     */
     void setButtonState(const Joypad::Button& button, const bool& state) {
-        if (state) { mState |= button; }
-        else { mState &= ~button; }
+        if (state) { mState.fetch_or(button, std::memory_order_relaxed); }
+        else { mState.fetch_and((Byte)~button, std::memory_order_relaxed); }
     }
 
     /**
@@ -91,7 +92,7 @@ public:
     * @see mStrobe
     */
     Byte read(void) {
-        Byte data = mState & (1 << mButtonIndex) ? 1 : 0;
+        Byte data = mState.load(std::memory_order_relaxed) & (1 << mButtonIndex) ? 1 : 0;
         if (!mStrobe) { mButtonIndex = (mButtonIndex + 1) % 8; }
         return data;
     }
@@ -99,8 +100,13 @@ public:
 
 private:
     
-    /** Current state of the joypad's buttons */
-    Byte mState;
+    /** 
+    * Current state of the joypad's buttons.
+    * It's set by the frontend, which may
+    * run on a different thread than
+    * the emulation.
+    */
+    std::atomic<Byte> mState;
 
     /** Index used to cycle over the state register */
     Byte mButtonIndex;
@@ -0,0 +1,60 @@
+#ifndef NULL_FRONTEND_H
+#define NULL_FRONTEND_H
+
+#include "IO/Frontend.h"
+
+/**
+* Frontend that discards all
+* of the video and audio output
+* and never presses any buttons.
+* It allows running the emulation
+* without a display or an audio
+* device, at the full speed of
+* the host.
+*/
+class NullFrontend : public Frontend {
+public:
+
+    /**
+    * Class constructor. Initializes
+    * an instance of the class with
+    * given parameters.
+    *
+    * @param frameLimit number of frames
+    *   after which the frontend closes,
+    *   0 means no limit
+    */
+    NullFrontend(const unsigned long& frameLimit = 0) :
+        mFrameLimit(frameLimit),
+        mFrameCount(0)
+    {}
+
+    void connectJoypads(Joypad* joypads) override { /* DO NOTHING */ }
+
+    bool isOpen(void) override { return !mFrameLimit || mFrameCount < mFrameLimit; }
+
+    void queueAudio(const int16_t* samples, const size_t& sampleCount) override { /* DO NOTHING */ }
+
+    double getSampleRateRatio(void) override { return 1.0; }
+
+    void swapBuffers(const uint32_t* frameBuffer, const uint64_t& frameHash) override { ++mFrameCount; }
+
+    /**
+    * Returns the number of frames
+    * generated so far.
+    *
+    * @return number of frames
+    */
+    unsigned long getFrameCount(void) const { return mFrameCount; }
+
+private:
+
+    /** Number of frames after which the frontend closes */
+    const unsigned long mFrameLimit;
+
+    /** Number of generated frames */
+    unsigned long mFrameCount;
+
+};
+
+#endif // !NULL_FRONTEND_H
@@ -0,0 +1,120 @@
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+/**
+* Lock-free ring buffer passing
+* values from a single producer thread
+* to a single consumer thread. Both
+* sides only copy the values and
+* publish their position, neither of
+* them ever waits for the other one.
+* The positions are kept on separate
+* cache lines, so the threads don't
+* share one.
+*
+* @tparam T type of the stored values
+*/
+template <typename T>
+class RingBuffer {
+public:
+
+    /**
+    * Class constructor. Initializes
+    * an empty ring buffer.
+    *
+    * @param capacity minimal number of
+    *   stored values, rounded up to a
+    *   power of two
+    */
+    RingBuffer(const size_t& capacity) : mWrite(0), mRead(0) {
+        size_t size = 1;
+        while (size < capacity) { size <<= 1; }
+        mValues.resize(size);
+        mMask = size - 1;
+    }
+
+    RingBuffer(const RingBuffer& other) = delete;
+    RingBuffer& operator=(const RingBuffer& other) = delete;
+
+    /**
+    * Copies the values into the
+    * buffer. Called by the producer.
+    *
+    * @param values values to be written
+    * @param count number of values
+    *
+    * @return number of written values,
+    *   smaller than count if the buffer
+    *   got full
+    */
+    size_t write(const T* values, const size_t& count) {
+        size_t write = mWrite.load(std::memory_order_relaxed);
+        size_t read = mRead.load(std::memory_order_acquire);
+        size_t written = std::min(count, this->getCapacity() - (write - read));
+        for (size_t i = 0; i < written; ++i) { mValues[(write + i) & mMask] = values[i]; }
+        mWrite.store(write + written, std::memory_order_release);
+        return written;
+    }
+
+    /**
+    * Copies the values out of the
+    * buffer. Called by the consumer.
+    *
+    * @param values array for the read values
+    * @param count number of values to read
+    *
+    * @return number of read values,
+    *   smaller than count if the buffer
+    *   ran out of values
+    */
+    size_t read(T* values, const size_t& count) {
+        size_t read = mRead.load(std::memory_order_relaxed);
+        size_t write = mWrite.load(std::memory_order_acquire);
+        size_t taken = std::min(count, write - read);
+        for (size_t i = 0; i < taken; ++i) { values[i] = mValues[(read + i) & mMask]; }
+        mRead.store(read + taken, std::memory_order_release);
+        return taken;
+    }
+
+    /**
+    * Returns the number of values
+    * in the buffer. It can be called
+    * by both sides, the value may
+    * change right after the call.
+    *
+    * @return number of stored values
+    */
+    size_t getSize(void) const {
+        return mWrite.load(std::memory_order_acquire) - mRead.load(std::memory_order_acquire);
+    }
+
+    /**
+    * Returns the number of values
+    * the buffer can hold.
+    *
+    * @return capacity of the buffer
+    */
+    size_t getCapacity(void) const { return mMask + 1; }
+
+private:
+
+    /** Storage of the values */
+    std::vector<T> mValues;
+
+    /** Mask wrapping the positions into the storage */
+    size_t mMask;
+
+    /** Number of values written so far, owned by the producer */
+    alignas(64) std::atomic<size_t> mWrite;
+
+    /** Number of values read so far, owned by the consumer */
+    alignas(64) std::atomic<size_t> mRead;
+
+};
+
+#endif // !RING_BUFFER_H
@@ -0,0 +1,107 @@
+#ifndef TRIPLE_BUFFER_H
+#define TRIPLE_BUFFER_H
+
+#include <atomic>
+#include <cstdint>
+
+/**
+* Lock-free triple buffer passing
+* values from a single producer thread
+* to a single consumer thread. The
+* producer fills the back slot and
+* publishes it, the consumer takes the
+* most recently published slot. Neither
+* of them ever waits for the other one.
+* If the producer publishes faster than
+* the consumer takes the slots, the
+* older values are dropped.
+*
+* @tparam T type of the stored values
+*/
+template <typename T>
+class TripleBuffer {
+public:
+
+    /**
+    * Class constructor. Initializes
+    * a class instance with default
+    * values.
+    */
+    TripleBuffer(void) : mBack(0), mMiddle(1), mFront(2) {}
+
+    TripleBuffer(const TripleBuffer& other) = delete;
+    TripleBuffer& operator=(const TripleBuffer& other) = delete;
+
+    /**
+    * Returns the slot owned by
+    * the producer. It can be
+    * modified until it gets
+    * published.
+    *
+    * @return back slot
+    */
+    T& getBack(void) { return mSlots[mBack].value; }
+
+    /**
+    * Publishes the back slot to
+    * the consumer and hands the
+    * producer a new back slot.
+    *
+    * @return true if the previously
+    *   published slot was never taken
+    *   by the consumer and got dropped
+    */
+    bool publish(void) {
+        uint8_t previous = mMiddle.exchange(mBack | FRESH, std::memory_order_acq_rel);
+        mBack = previous & INDEX;
+        return previous & FRESH;
+    }
+
+    /**
+    * Takes the most recently published
+    * slot, if the producer published
+    * one since the last call.
+    *
+    * @return true if the front slot
+    *   holds a new value
+    */
+    bool acquire(void) {
+        if (!(mMiddle.load(std::memory_order_relaxed) & FRESH)) { return false; }
+        mFront = mMiddle.exchange(mFront, std::memory_order_acq_rel) & INDEX;
+        return true;
+    }
+
+    /**
+    * Returns the slot owned by
+    * the consumer.
+    *
+    * @return front slot
+    */
+    const T& getFront(void) const { return mSlots[mFront].value; }
+
+private:
+
+    /** Mask of the slot index */
+    inline static constexpr uint8_t INDEX = 0x3;
+
+    /** Flag marking a published slot that wasn't taken yet */
+    inline static constexpr uint8_t FRESH = 0x4;
+
+    /** Slot padded to a cache line, so the threads don't share one */
+    struct alignas(64) Slot { T value; };
+
+    /** Storage of the values */
+    Slot mSlots[3];
+
+    /** Index of the slot owned by the producer */
+    alignas(64) uint8_t mBack;
+
+    /** Index of the published slot, with the FRESH flag */
+    alignas(64) std::atomic<uint8_t> mMiddle;
+
+    /** Index of the slot owned by the consumer */
+    alignas(64) uint8_t mFront;
+
+};
+
+#endif // !TRIPLE_BUFFER_H
@@ -3,12 +3,14 @@
 
 #include <string>
 #include <cstdint>
-#include <functional>
+#include <atomic>
+#include <chrono>
 
 #include "raylib.h"
 
-#include "NES/PPU2C02/ColourLUT.h"
-#include "IO/Joypad.h"
+#include "IO/Frontend.h"
+#include "IO/RingBuffer.h"
+#include "IO/TripleBuffer.h"
 
 /**
 * Options of the app window.
@@ -32,13 +34,48 @@ struct ScreenOptions {
 /**
 * Options for the audio device.
 * The structure stores the sample rate,
-* sample size (bit depth) and number
-* of channels.
+* sample size (bit depth), number
+* of channels, size of the device
+* buffer in samples and the amount
+* of queued audio (in milliseconds)
+* the emulation aims to keep.
 */
 struct AudioOptions {
     unsigned int sampleRate = 44100;
     unsigned int sampleSize = 16;
     unsigned int channels = 1;
+    unsigned int bufferSize = 512;
+    unsigned int latency = 20;
+};
+
+/**
+* Timing statistics of the
+* frame pipeline. Times are
+* averaged over all frames and
+* given in milliseconds.
+*/
+struct FrameStats {
+    unsigned long framesEmulated = 0;
+    unsigned long framesPresented = 0;
+    unsigned long framesDropped = 0;    //emulated, but replaced by a newer frame before presenting
+    unsigned long framesUnchanged = 0;  //presented without an upload, equal to the previous frame
+    double emulationTime = 0.0;         //time the emulation thread spent on a frame
+    double presentationTime = 0.0;      //time the presenter spent uploading and drawing a frame
+    double latency = 0.0;               //time from handing a frame over until it was presented
+    double maxLatency = 0.0;
+};
+
+/**
+* Statistics of the audio
+* stream. Underruns and overruns
+* are counted once per affected 
+* callback or queued block of 
+* samples.
+*/
+struct AudioStats {
+    unsigned long underruns = 0;    //callbacks that ran out of samples
+    unsigned long overruns = 0;     //blocks of samples that didn't fit into the ring
+    size_t queuedSamples = 0;       //samples waiting for playback
 };
 
 /**
@@ -46,7 +83,7 @@ struct AudioOptions {
 * accessing graphics
 * and audio APIs.
 */
-class Window {
+class Window : public Frontend {
 public:
 
     Window(const Window& other) = delete;
@@ -58,8 +95,6 @@ public:
     * instance doesn't exist it 
     * creates one and returns it.
     * 
-    * @param joypad joypad object that
-    *   will store the user input data
     * @param screenOptions screen
     *   configuration options
     * @param audioOptions audio device
@@ -68,11 +103,10 @@ public:
     * @return window instance
     * 
     * @see sInstance
-    * @see Joypad
     * @see ScreenOptions
     * @see AudioOptions
     */
-    static Window* getInstance(Joypad* joypads, const ScreenOptions& screenOptions, const AudioOptions& audioOptions);
+    static Window* getInstance(const ScreenOptions& screenOptions, const AudioOptions& audioOptions);
 
     /**
     * Deletes the current instance
@@ -82,67 +116,143 @@ public:
     * 
     * @see sInstance
     */
-    static void destroyInstance(void) { delete sInstance; }
+    static void destroyInstance(void) { delete sInstance; sInstance = nullptr; }
 
     /**
-    * Starts playing the audio stream
+    * Connects the joypads that
+    * will receive the user input.
     * 
-    * @see mAudioStream
+    * @param joypads joypad objects that
+    *   will store the user input data
+    * 
+    * @see mJoypads
+    * @see handleInputs
     */
-    void playAudioStream(void);
+    void connectJoypads(Joypad* joypads) override;
 
     /**
-    * Sets the callback of the
-    * audio device. This callback
-    * will be called upon an empty
-    * audio buffer.
+    * Runs the presentation loop until
+    * the window gets closed. It captures
+    * the user input and draws the most
+    * recent frame handed over by the 
+    * emulation thread. Frames with the 
+    * same hash as the frame in the texture
+    * aren't uploaded again. It has to be called 
+    * on the thread that created the window,
+    * while the emulation runs on another one.
     * 
-    * @param audioStreamCallback
-    *   audio stream callback that
-    *   will be called upon an empty
-    *   audio buffer.
+    * @see swapBuffers
+    * @see mFrames
+    */
+    void present(void);
+
+    /**
+    * Closes the window, which ends
+    * the presentation loop and the
+    * emulation.
     * 
-    * @see mAudioStreamCallback
+    * @see mIsOpen
     */
-    void setAudioStreamCallback(std::function<void(void*, unsigned int)> audioStreamCallback);
+    void close(void) { mIsOpen = false; }
 
     /**
-    * Wrapper for the audio stream callback to
-    * be passed into RayLib. This is specifically
-    * connected with how this library works.
+    * Returns the timing statistics
+    * of the frames emulated and
+    * presented so far.
     * 
-    * @param buffer audio buffer to be filled
-    * @param frames length of the audio buffer
+    * @return frame statistics
     * 
-    * @see mAudioStreamCallback
+    * @see FrameStats
     */
-    static void audioStreamCallback(void* buffer, unsigned int frames);
+    FrameStats getFrameStats(void) const;
 
     /**
-    * Returns the current audio buffer size
+    * Returns the statistics of
+    * the audio stream.
     * 
-    * @return audio buffer size
+    * @return audio statistics
     * 
-    * @see mAudioBufferSize
+    * @see AudioStats
     */
-    short getAudioBufferSize(void) { return mAudioBufferSize; }
+    AudioStats getAudioStats(void) const;
 
     /**
-    * Swaps the video buffers, displaying
-    * the freshly generated frame.
+    * Returns the information if
+    * the window is still open.
+    * 
+    * @return true if the window
+    *   hasn't been closed
+    * 
+    * @see mIsOpen
+    */
+    bool isOpen(void) override { return mIsOpen; }
+
+    /**
+    * Queues the audio samples for
+    * playback. Samples that don't fit
+    * into the ring are dropped and
+    * counted as an overrun. It never
+    * waits for the audio device.
+    * 
+    * @param samples mono 16 bit
+    *   audio samples
+    * @param sampleCount number of
+    *   samples
+    * 
+    * @see mAudioRing
+    */
+    void queueAudio(const int16_t* samples, const size_t& sampleCount) override;
+
+    /**
+    * Returns the sample rate ratio
+    * steering the queued audio towards
+    * the configured latency. It is
+    * updated on every queueAudio() call
+    * from the smoothed fill level of
+    * the ring, by at most
+    * MAX_RATE_ADJUSTMENT.
+    * 
+    * @return sample rate ratio
+    * 
+    * @see mSampleRateRatio
+    */
+    double getSampleRateRatio(void) override { return mSampleRateRatio; }
+
+    /**
+    * Audio stream callback passed into
+    * RayLib. It only copies the queued
+    * samples into the audio buffer. If
+    * there are not enough samples, the 
+    * rest of the buffer is filled with
+    * the last played sample and the
+    * callback is counted as an underrun.
+    * The playback then waits until the
+    * ring fills up to the target level.
+    * 
+    * @param buffer audio buffer to be filled
+    * @param frames length of the audio buffer
+    * 
+    * @see mAudioRing
     */
-    void swapBuffers(void);
+    static void audioStreamCallback(void* buffer, unsigned int frames);
 
     /**
-    * Draws a pixel to the video buffer.
+    * Hands the freshly generated frame
+    * together with its hash over to
+    * the presentation loop and
+    * waits until it's time to emulate
+    * the next one, so the emulation runs
+    * at the speed of the NES. It never 
+    * waits for the frame to be presented.
     * 
-    * @param posX x coordinate of the pixel
-    * @param posY y coordinate of the pixel
-    * @param colour colour of the pixel
+    * @param frameBuffer packed RGBA
+    *   pixels of the frame, row by row
+    * @param frameHash hash of the pixels
     * 
-    * @see Colour
+    * @see present
+    * @see mFrames
     */
-    void drawPixel(const int& posX, const int& posY, const Colour& colour);
+    void swapBuffers(const uint32_t* frameBuffer, const uint64_t& frameHash) override;
  
 private:
 
@@ -151,18 +261,15 @@ private:
     * static instance of the class with 
     * given parameters.
     * 
-    * @param joypad joypad object that
-    *   will store the user input data
     * @param screenOptions screen
     *   configuration options
     * @param audioOptions audio device
     *   configuration options
     * 
-    * @see Joypad
     * @see ScreenOptions
     * @see AudioOptions
     */
-    Window(Joypad* joypads, const ScreenOptions& screenOptions, const AudioOptions& audioOptions);
+    Window(const ScreenOptions& screenOptions, const AudioOptions& audioOptions);
 
     /**
     * Class destructor. Unloads
@@ -174,32 +281,132 @@ private:
     */
     ~Window(void);
 
+    /**
+    * Loads the key bindings of
+    * the joypads from the config
+    * file. If it can't be opened,
+    * the default bindings are used.
+    * 
+    * @see mKeyBindings
+    */
+    void loadKeyBindings(void);
+
     /**
     * Captures the user input
     * and writes the data
-    * to the joypad object.
+    * to the joypad objects.
     * 
-    * @see mJoypad
+    * @see mJoypads
     */
     void handleInputs(void);
 
+    using Clock = std::chrono::steady_clock;
+
+    /** Duration of a NES frame (60.0988 frames per second) */
+    inline static constexpr Clock::duration FRAME_DURATION = std::chrono::nanoseconds(16639267);
+
+    /** Adjustment of the sample rate when the ring is empty, or twice as full as it should be */
+    inline static constexpr double MAX_RATE_ADJUSTMENT = 0.005;
+
+    /** Number of frames the fill level of the ring is averaged over */
+    inline static constexpr double FILL_SMOOTHING = 16.0;
+
+    /** Number of pixels in a frame */
+    inline static constexpr size_t FRAME_PIXELS = 256 * 240;
+
+    /** Frame passed from the emulation thread to the presenter */
+    struct PresentedFrame {
+        uint32_t pixels[FRAME_PIXELS];
+        uint64_t hash;
+        Clock::time_point handedOver;
+    };
+
     /** Static instance of the window */
     static Window* sInstance;
 
-    /** Callback that will be called upon an empty audio buffer */
-    std::function<void(void*, unsigned int)> mAudioStreamCallback;
+    /** Frames handed over to the presenter */
+    TripleBuffer<PresentedFrame> mFrames;
+
+    /** Time at which the emulation of the next frame starts */
+    Clock::time_point mNextFrameTime;
+
+    /** Time at which the emulation of the current frame started */
+    Clock::time_point mFrameStartTime;
+
+    /** Number of frames handed over by the emulation thread */
+    std::atomic<unsigned long> mFramesEmulated;
+
+    /** Number of frames presented */
+    std::atomic<unsigned long> mFramesPresented;
+
+    /** Number of frames dropped before presenting */
+    std::atomic<unsigned long> mFramesDropped;
 
-    /** Joypad that stores the user input data */
+    /** Number of presented frames equal to the previous one */
+    std::atomic<unsigned long> mFramesUnchanged;
+
+    /** Total time the emulation thread spent on the frames */
+    std::atomic<Clock::rep> mEmulationTime;
+
+    /** Total time the presenter spent on the frames */
+    std::atomic<Clock::rep> mPresentationTime;
+
+    /** Total latency of the presented frames */
+    std::atomic<Clock::rep> mLatency;
+
+    /** Highest latency of a presented frame */
+    std::atomic<Clock::rep> mMaxLatency;
+
+    /** Keys bound to the buttons of each joypad, in the order of their bits */
+    int mKeyBindings[2][8];
+
+    /** Samples waiting for playback */
+    RingBuffer<int16_t> mAudioRing;
+
+    /** Number of audio callbacks that ran out of samples */
+    std::atomic<unsigned long> mAudioUnderruns;
+
+    /** Number of sample blocks that didn't fit into the ring */
+    std::atomic<unsigned long> mAudioOverruns;
+
+    /** Number of queued samples the rate control aims for */
+    const double mAudioTarget;
+
+    /** Smoothed number of queued samples, used only by the emulation thread */
+    double mAverageFill;
+
+    /** Sample rate ratio asked for by the rate control */
+    double mSampleRateRatio;
+
+    /** Last sample handed to the audio device, used only by the callback */
+    int16_t mLastSample;
+
+    /** Flag indicating if the ring was filled up for playback, used only by the callback */
+    bool mAudioPrimed;
+
+    /** Joypads that store the user input data */
     Joypad* mJoypads[2];
 
+    /** Flag indicating if the window is still open */
+    std::atomic<bool> mIsOpen;
+
     /** Application's audio stream */
     AudioStream mAudioStream;
 
+    /** Texture holding the displayed frame */
+    Texture2D mFrameTexture;
+
+    /** Hash of the frame in the texture */
+    uint64_t mTextureHash;
+
+    /** Flag indicating if the texture holds a frame */
+    bool mTextureLoaded;
+
     /** Screen scaling factor */
     const short mScale;
 
     /** Audio buffer size */
-    const short mAudioBufferSize;
+    const unsigned int mAudioBufferSize;
 
 };
 
@@ -1,12 +1,15 @@
 #ifndef APU_H
 #define APU_H
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <vector>
 
+#include "NES/APU/BlipBuffer.h"
 #include "NES/APU/Oscillator.h"
 #include "NES/APU/OscLUT.h"
 #include "NES/APU/DMC.h"
-#include "IO/Window.h"
 
 class CPUBus;
 
@@ -80,25 +83,61 @@ public:
     * Class constructor. Initializes an instance
     * of the class with given parameters.
     * 
-    * @param window application window that
-    *   will handle audio output.
     * @param sampleRate audio device sample rate
+    */
+    APU(const unsigned int& sampleRate);
+
+    /**
+    * Moves the APU forward by
+    * a given number of CPU cycles.
+    * No work is done here, the
+    * oscillators catch up with the
+    * APU only when their state or
+    * output is needed.
+    * 
+    * @param cycles number of CPU cycles
     * 
-    * @see Window
+    * @see runChannels
     */
-    APU(Window* window, const unsigned int& sampleRate);
+    void run(const unsigned int& cycles);
 
     /**
-    * Class destructor. Dealocates the audio buffer.
+    * Executes the current step of
+    * the frame sequencer, clocking
+    * the envelopes, the linear counter,
+    * the note lengths and the sweeps
+    * due at that step. It has to be 
+    * called at the cycle of the step.
+    * 
+    * @see getCyclesUntilFrameStep
+    */
+    void clockFrameSequencer(void);
+
+    /**
+    * Returns the number of CPU cycles
+    * between the previous and the 
+    * next step of the frame sequencer.
+    * 
+    * @return CPU cycles until the
+    *   next step
     * 
-    * @see mAudioBuffer
+    * @see FRAME_STEPS
     */
-    ~APU(void);
+    unsigned int getCyclesUntilFrameStep(void) const {
+        unsigned short previous = mFrameStep ? FRAME_STEPS[mFrameStep - 1] : 0;
+        return CPU_CYCLES_PER_CLOCK * (FRAME_STEPS[mFrameStep] - previous);
+    }
 
     /**
-    * Clocks the APU. 
+    * Ends the current audio frame.
+    * The oscillators catch up with
+    * the APU and the samples for all
+    * of the emulated time are generated.
+    * 
+    * @see mSamples
+    * @see mBlipBuffer
     */
-    void clock(void);
+    void endFrame(void);
 
     /**
     * Responds to a read call.
@@ -129,19 +168,49 @@ public:
     void writeRegister(const Byte& data, const Word& address);
 
     /**
-    * Fills the audio buffer with
-    * a given amount of samples.
-    * Data written to a buffer is
-    * scaled from floats ranging
-    * from -1.0f - 1.0f to shorts
-    * filling the whole short int 
-    * value range.
+    * Returns the samples generated
+    * since the last call to
+    * clearSamples(). Only the time
+    * up to the last endFrame() call
+    * is covered.
+    * 
+    * @return generated samples
+    * 
+    * @see mSamples
+    */
+    const int16_t* getSamples(void) const { return mSamples.data(); }
+
+    /**
+    * Returns the number of samples
+    * generated since the last call
+    * to clearSamples().
     * 
-    * @param buffer audio buffer to
-    *   be filled
-    * @param frames audio buffer length
+    * @return number of samples
+    * 
+    * @see mSamples
     */
-    void update(void* buffer, unsigned int frames);
+    size_t getSampleCount(void) const { return mSamples.size(); }
+
+    /**
+    * Discards the generated samples.
+    * 
+    * @see mSamples
+    */
+    void clearSamples(void) { mSamples.clear(); }
+
+    /**
+    * Adjusts the rate of the generated
+    * samples relative to the audio device
+    * sample rate. The frontend uses it to
+    * keep its audio buffer at a steady
+    * level. The new rate applies from 
+    * the next audio frame.
+    * 
+    * @param ratio ratio of the generated
+    *   and the device sample rate, limited
+    *   to 1.0 +- MAX_RATE_ADJUSTMENT
+    */
+    void setSampleRateRatio(const double& ratio);
 
     void setCpuBus(CPUBus* cpuBus) { mDMC.setCpuBus(cpuBus); }
 
@@ -289,17 +358,108 @@ private:
     void updateStatus(const Byte& data);
 
     /**
-    * Clocks all oscillators
-    * and mixes their signals
-    * to get the final sample.
+    * Clocks the envelopes and
+    * the triangle's linear counter.
+    */
+    void quarterFrame(void);
+
+    /**
+    * Clocks everything clocked
+    * on a quarter frame, the
+    * note lengths and the sweeps.
+    */
+    void halfFrame(void);
+
+    /**
+    * Clocks the oscillators' timers
+    * up to the given time. The timers
+    * expire one after another in
+    * order, so the output changes
+    * are added at the exact cycle 
+    * they happen at.
     * 
-    * @return final sample
+    * @param time CPU cycle of the
+    *   current audio frame
     * 
-    * @see mPulse
-    * @see mTriangle
-    * @see mNoise
+    * @see mTimers
     */
-    float getSample(void);
+    void runChannels(const unsigned int& time);
+
+    /**
+    * Mixes the output levels of
+    * the oscillators and adds the
+    * change of the output, if there
+    * is one, to the blip buffer.
+    * 
+    * @param time CPU cycle of the
+    *   current audio frame
+    * 
+    * @see mOutput
+    */
+    void updateOutput(const unsigned int& time);
+
+    /**
+    * Mixes the output levels of
+    * the oscillators and the DMC.
+    * The NES mixes them nonlinearly,
+    * the pulse channels and the rest
+    * separately, which is done by
+    * looking the sums of the levels
+    * up in two tables.
+    * 
+    * @return output amplitude
+    * 
+    * @see PULSE_TABLE
+    * @see TND_TABLE
+    */
+    int mix(void) const;
+
+    /** Number of oscillators with a timer */
+    inline static constexpr int CHANNEL_COUNT = 4;
+
+    /** Number of CPU cycles per APU cycle */
+    inline static constexpr unsigned int CPU_CYCLES_PER_CLOCK = 2;
+
+    /** 
+    * APU cycles of the frame sequencer
+    * steps. The last one is reached
+    * only in the 5 step mode.
+    */
+    inline static constexpr unsigned short FRAME_STEPS[5] = { 3728, 7456, 11185, 14914, 18640 };
+
+    /** 
+    * Longest audio frame. Longer frames
+    * are ended by the APU itself. 
+    */
+    inline static constexpr unsigned int MAX_FRAME_CYCLES = 1 << 15;
+
+    /** Largest relative adjustment of the sample rate */
+    inline static constexpr double MAX_RATE_ADJUSTMENT = 0.005;
+
+    /** Amplitude of the mixer output at 1.0 */
+    inline static constexpr double MIX_AMPLITUDE = 32000.0;
+
+    /** 
+    * Output of the pulse channels
+    * for the sum of their levels 
+    */
+    inline static constexpr std::array<int, 31> PULSE_TABLE = [] {
+        std::array<int, 31> table{};
+        for (int n = 1; n < 31; ++n) { table[n] = (int)(MIX_AMPLITUDE * 95.52 / (8128.0 / n + 100.0) + 0.5); }
+        return table;
+    }();
+
+    /** 
+    * Output of the triangle, noise
+    * and DMC channels for the sum
+    * of their levels (3 * triangle 
+    * + 2 * noise + DMC)
+    */
+    inline static constexpr std::array<int, 203> TND_TABLE = [] {
+        std::array<int, 203> table{};
+        for (int n = 1; n < 203; ++n) { table[n] = (int)(MIX_AMPLITUDE * 163.67 / (24329.0 / n + 100.0) + 0.5); }
+        return table;
+    }();
 
     /**
     * Lookup table for fetching
@@ -330,14 +490,30 @@ private:
     /** Internal DMC module */
     DMC mDMC;
 
-    /** Cycle counter */
-    unsigned short mCycles;
+    /** Index of the next frame sequencer step */
+    Byte mFrameStep;
+
+    /** Audio device sample rate */
+    const unsigned int mSampleRate;
+
+    /** CPU cycles since the start of the audio frame */
+    unsigned int mTime;
+
+    /**
+    * CPU cycles of the next timer 
+    * expirations of the pulse, triangle
+    * and noise oscillators (in that order)
+    */
+    unsigned int mTimers[CHANNEL_COUNT];
+
+    /** Output amplitude added to the blip buffer */
+    int mOutput;
 
-    /** Audio buffer */
-    short* mAudioBuffer;
+    /** Buffer turning the output changes into samples */
+    BlipBuffer mBlipBuffer;
 
-    /** Audio buffer size */
-    unsigned short mAudioBufferSize;
+    /** Samples generated so far */
+    std::vector<int16_t> mSamples;
 
 };
 
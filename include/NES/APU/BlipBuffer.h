@@ -0,0 +1,134 @@
+#ifndef BLIP_BUFFER_H
+#define BLIP_BUFFER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+* Band-limited step buffer. It turns
+* amplitude changes of a signal clocked
+* at the emulated clock rate into samples
+* at the host sample rate. Every change
+* is added as a band-limited step, so
+* the cost depends on the number of
+* changes, not on the number of samples,
+* and the output has no aliasing of the
+* square edges. Times are given in
+* clocks since the end of the last frame.
+*/
+class BlipBuffer {
+public:
+
+    /**
+    * Class constructor. Initializes
+    * the buffer for the given rates.
+    *
+    * @param clockRate rate of the
+    *   emulated clock in hertz
+    * @param sampleRate rate of the
+    *   generated samples in hertz
+    * @param maxFrameClocks the longest
+    *   frame passed to endFrame()
+    */
+    BlipBuffer(const double& clockRate, const double& sampleRate, const unsigned int& maxFrameClocks);
+
+    /**
+    * Changes the rate of the generated
+    * samples. It should be called only 
+    * between the frames, the deltas of
+    * the current frame are resampled
+    * with the new rate otherwise.
+    *
+    * @param sampleRate rate of the
+    *   generated samples in hertz
+    */
+    void setSampleRate(const double& sampleRate);
+
+    /**
+    * Adds an amplitude change
+    * to the signal.
+    *
+    * @param time clock of the change
+    *   within the current frame
+    * @param delta difference between
+    *   the new and the old amplitude
+    */
+    void addDelta(const unsigned int& time, const int& delta);
+
+    /**
+    * Ends the current frame. The
+    * samples covering it become
+    * available and the following
+    * times are counted from its end.
+    *
+    * @param time length of the frame
+    *   in clocks
+    */
+    void endFrame(const unsigned int& time);
+
+    /**
+    * Returns the number of
+    * samples ready to be read.
+    *
+    * @return number of samples
+    */
+    size_t getSamplesAvailable(void) const { return mOffset >> FRAC_BITS; }
+
+    /**
+    * Reads the available samples
+    * and removes them from the buffer.
+    *
+    * @param samples output array
+    * @param count number of samples to
+    *   read, at most getSamplesAvailable()
+    */
+    void readSamples(int16_t* samples, const size_t& count);
+
+private:
+
+    /** Fractional bits of the sample positions */
+    inline static constexpr int FRAC_BITS = 32;
+
+    /** Bits of the sample positions picking the kernel phase */
+    inline static constexpr int PHASE_BITS = 6;
+
+    /** Number of kernel phases */
+    inline static constexpr int PHASES = 1 << PHASE_BITS;
+
+    /** Number of samples a single step is spread over */
+    inline static constexpr int KERNEL_WIDTH = 16;
+
+    /** Precision of the kernel, every phase sums up to 1 << KERNEL_BITS */
+    inline static constexpr int KERNEL_BITS = 12;
+
+    /** Strength of the high-pass filter removing the DC offset */
+    inline static constexpr int BASS_SHIFT = 9;
+
+    /** Cutoff of the kernel's low-pass filter in fractions of the sample rate */
+    inline static constexpr double CUTOFF = 0.45;
+
+    /** Band-limited steps, differentiated for every phase */
+    int16_t mKernel[PHASES][KERNEL_WIDTH];
+
+    /** Rate of the emulated clock in hertz */
+    const double mClockRate;
+
+    /** Length of the longest frame in clocks */
+    const unsigned int mMaxFrameClocks;
+
+    /** Samples per clock in 32.32 fixed point */
+    uint64_t mFactor;
+
+    /** Sample position of the current frame's start in 32.32 fixed point */
+    uint64_t mOffset;
+
+    /** State of the integrator turning the differences into samples */
+    int32_t mIntegrator;
+
+    /** Differences between consecutive samples */
+    std::vector<int32_t> mBuffer;
+
+};
+
+#endif // !BLIP_BUFFER_H
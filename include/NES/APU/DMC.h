@@ -99,6 +99,16 @@ public:
   */
   float process(void);
 
+  /*
+  * @brief returns the 
+  *   output level used
+  *   by the APU mixer
+  * 
+  * @return output level
+  *   (0 - 127)
+  */
+  Byte getLevel(void) const { return mOutputLevel; }
+
   /*
   * @brief updates the address
   *   of the CPU Bus object 
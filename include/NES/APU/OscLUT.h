@@ -32,7 +32,7 @@ class OscLUT {
     * 
     * @see mDutyCycles
     */
-    const float& getDutyCycle(const Byte& code) const { return mDutyCycles[code & 0x3]; }
+    const Byte& getDutyCycle(const Byte& code) const { return mDutyCycles[code & 0x3]; }
 
     /**
     * Returns the note length
@@ -60,12 +60,15 @@ class OscLUT {
     */
     const Word& getNoiseFrequency(const Byte& code) const { return mNoiseFrequency[code & 0xF]; }
 
-    /** An array of available duty cycles */
-    const float mDutyCycles[4] = {
-        0.125f,
-        0.250f,
-        0.500f,
-        0.750f
+    /** 
+    * An array of available duty cycles,
+    * given as sequences of 8 steps
+    */
+    const Byte mDutyCycles[4] = {
+        Byte(0b00000010),   //12.5%
+        Byte(0b00000110),   //25%
+        Byte(0b00011110),   //50%
+        Byte(0b11111001)    //75% (25% negated)
     };
 
     /** An array of available note lengths */
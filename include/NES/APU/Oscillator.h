@@ -80,7 +80,6 @@ public:
     * 
     * @see mInitialAmplitude
     * @see mCurrentAmplitude
-    * @see mRealAmplitude
     */
     void setAmplitude(const Byte& amplitude);
 
@@ -96,15 +95,6 @@ public:
     */
     void setFrequency(const Byte& frequency, const bool& highByte);
 
-    /**
-    * Sets the oscillator's sample rate.
-    * 
-    * @param sampleRate oscillator's sample rate
-    * 
-    * @see mSampleRate
-    */
-    void setSampleRate(const unsigned int& sampleRate);
-
     /**
     * Returns the information if the
     * oscillator is enabled.
@@ -154,15 +144,6 @@ public:
     */
     Word getFrequency(void) { return mFrequency; }
 
-    /**
-    * Returns the oscillator's sample rate
-    * 
-    * @return oscillator's sample rate
-    * 
-    * @see mSampleRate
-    */
-    unsigned int getSampleRate(void) { return mSampleRate; }
-
     /**
     * Updates the note length.
     * If the note length reaches
@@ -192,29 +173,16 @@ public:
     * @see mDivider
     * @see mInitialAmplitude
     * @see mCurrentAmplitude
-    * @see mRealAmplitude
     * @see mHasConstantVolume
     */
     void updateVolume(void);
 
-    /**
-    * Clocks the oscillator
-    * and returns the next
-    * sample value.
-    * 
-    * @return generated audio sample
-    */
-    float process(void);
-
     /** Default oscillator amplitude */
     inline static constexpr Byte DEFAULT_AMPLITUDE = 0;
 
     /** Default oscillator frequency */
     inline static constexpr Word DEFAULT_FREQUENCY = 0xFFFF;
 
-    /** Default oscillator sample rate */
-    inline static constexpr unsigned int DEFAULT_SAMPLE_RATE = 44100;
-
 protected:
 
     /** Flag indicating if the oscillator is enabled */
@@ -238,17 +206,11 @@ protected:
     /** Current amplitude of the oscillator */
     Byte mCurrentAmplitude;
     
-    /** Frequency of the oscillator */
-    Word mFrequency;
-
     /** 
-    * Current amplitude of the oscillator 
-    * in the range of 0.0f - 1.0f.
+    * Frequency of the oscillator, given
+    * as the period of its timer.
     */
-    float mRealAmplitude;
-
-    /** Sample rate of the oscillator */
-    unsigned int mSampleRate;
+    Word mFrequency;
 
 };
 
@@ -289,40 +251,39 @@ public:
     bool getModeFlag(void) { return mMode; }
 
     /**
-    * Sets the sample rate of
-    * the oscillator.
+    * Sets the period of the
+    * oscillator's timer.
+    * 
+    * @param period timer period
+    *   in CPU cycles
+    * 
+    * @see mFrequency
     */
-    void setSampleRate(const unsigned int& sampleRate);
+    void setPeriod(const Word& period) { mFrequency = period; }
 
     /**
-    * Clocks the oscillator
-    * and returns the next
-    * sample value stored
-    * in the internal shift
-    * register.
+    * Clocks the internal shift
+    * register, which happens
+    * every time the oscillator's
+    * timer expires.
     * 
-    * @return generated audio sample
+    * @return number of CPU cycles
+    *   until the timer expires again
+    * 
+    * @see mLFSR
+    * @see mFrequency
     */
-    float process(void);
-
-private:
+    unsigned int step(void);
 
     /**
-    * Updates the internal
-    * shift register by
-    * performing a bit shift.
-    * This operation is performed
-    * only when a certain amount
-    * of time has passed. This 
-    * is dictated by the oscillator's
-    * frequency.
+    * Returns the current output
+    * level of the oscillator.
     * 
-    * @see mLFSR
-    * @see mFrequency
-    * @see mAngle
-    * @see mOffset
+    * @return output level (0 - 15)
     */
-    void updateRegister(void);
+    Byte getLevel(void) const;
+
+private:
 
     /**
     * Flag determining the
@@ -344,21 +305,6 @@ private:
     */
     Word mLFSR;
 
-    /**
-    * Increment that the
-    * angle is changed by
-    * every oscillator cycle.
-    */
-    float mOffset;
-
-    /**
-    * Angle of the oscillator.
-    * It is treated as an argument
-    * to the noise function determining
-    * when to shift the shift register.
-    */
-    float mAngle;
-
 };
 
 /**
@@ -422,45 +368,27 @@ public:
     void updateLinearCounter(void);
 
     /**
-    * Sets the oscillator's 
-    * frequency
-    * 
-    * @param frequency oscillator's
-    *   frequency
-    * @param hightByte flag to indicate
-    *   if the write is reffering to the 
-    *   high or low byte of the frequency
-    * 
-    * @see mFrequency
-    * @see mOffset
-    * @see mAngle
-    */
-    void setFrequency(const Byte& frequency, const bool& highByte);
-
-    /**
-    * Sets the oscillator's sample rate
+    * Moves the oscillator to the
+    * next of its output values, 
+    * which happens every time its
+    * timer expires. Ultrasonic
+    * periods hold the output.
     * 
-    * @param sampleRate oscillator's
-    *   sample rate
+    * @return number of CPU cycles
+    *   until the timer expires again
     * 
-    * @see mSampleRate
+    * @see OUTPUT_VALUES
+    * @see mSequenceStep
     */
-    void setSampleRate(const unsigned int& sampleRate);
+    unsigned int step(void);
 
     /**
-    * Clocks the oscillator
-    * and returns the next
-    * sample value. The values
-    * are fetched from the predefined
-    * sample values.
-    * 
-    * @return fetched audio sample
+    * Returns the current output
+    * level of the oscillator.
     * 
-    * @see OUTPUT_VALUES
-    * @see mAngle
-    * @see mOffset
+    * @return output level (0 - 15)
     */
-    float process(void);
+    Byte getLevel(void) const;
 
 private:
 
@@ -476,22 +404,20 @@ private:
     /** Counts the APU cycles */
     Byte mLinearCounter;
 
+    /** Index of the current output value */
+    Byte mSequenceStep;
+
     /** 
-    * Current frequency of the 
-    * oscillator given in hertz.
+    * Number of CPU cycles after which
+    * an ultrasonic period is checked again
     */
-    float mRealFrequency;
-    float mOffset;
-    float mAngle;
-
-    /** Max NES' output amplitude */
-    static constexpr float MAX_OUTPUT_VALUE = 15.0f;
+    static constexpr unsigned int ULTRASONIC_POLL = 32;
 
     /** Amount of possible output sample values */
     static constexpr Byte NUM_OUTPUT_VALUES = 32;
 
     /** Predefined oscillator output values */
-    static constexpr float OUTPUT_VALUES[32] = {
+    static constexpr Byte OUTPUT_VALUES[32] = {
         15, 14, 13, 12, 11, 10,  9,  8,  7,  6,  5,  4,  3,  2,  1,  0,
          0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15
     };
@@ -512,12 +438,12 @@ public:
     * Sets the oscillator's
     * duty cycle.
     * 
-    * @param dutyCycle value of the
-    *   duty cycle
+    * @param dutyCycle sequence of the
+    *   duty cycle, one bit per step
     *
     * @see mDutyCycle
     */
-    void setDutyCycle(const float& dutyCycle);
+    void setDutyCycle(const Byte& dutyCycle) { mDutyCycle = dutyCycle; }
 
     /**
     * Sets the oscillator's frequency.
@@ -528,20 +454,10 @@ public:
     *   or low byte of the frequency
     * 
     * @see mFrequency
-    * @see mRealFrequency
+    * @see mSequenceStep
     */
     void setFrequency(const Byte& frequency, const bool& highByteWrite);
 
-    /**
-    * Sets the oscillator's sample rate
-    * 
-    * @param sampleRate oscillator's
-    *   sample rate
-    *   
-    * @see mSampleRate
-    */
-    void setSampleRate(const unsigned int& sampleRate);
-
     /**
     * Enables or disables the oscillator's
     * sweep unit.
@@ -593,19 +509,31 @@ public:
     void updateSweep(void);
 
     /**
-    * Clocks the oscillator
-    * and returns the next
-    * generated sample value.
+    * Moves the oscillator to the
+    * next step of its duty cycle,
+    * which happens every time its
+    * timer expires.
+    * 
+    * @return number of CPU cycles
+    *   until the timer expires again
     * 
-    * @return generated audio sample
+    * @see mDutyCycle
+    * @see mSequenceStep
+    */
+    unsigned int step(void);
+
+    /**
+    * Returns the current output
+    * level of the oscillator. Periods
+    * out of the 8 - 0x7FF range are
+    * muted.
     * 
-    * @see mAngle
-    * @see mOffset
+    * @return output level (0 - 15)
     */
-    float process(void);
+    Byte getLevel(void) const;
 
-    /** Default duty cycle */
-    static constexpr float DEFAULT_DUTY_CYCLE = 0.5f;
+    /** Default duty cycle (50%) */
+    static constexpr Byte DEFAULT_DUTY_CYCLE = 0b00011110;
 
 private:
 
@@ -631,26 +559,13 @@ private:
     Byte mSweepClock;
 
     /** 
-    * Current frequency of the 
-    * oscillator given in hertz.
-    */
-    float mRealFrequency;
-
-    /** Ratio between the length of high and low signal */
-    float mDutyCycle;
-
-    /**
-    * Offset that the angle
-    * is incremented by every
-    * generated sample.
+    * Duty cycle sequence. Bit n
+    * is the output of step n.
     */
-    float mOffset;
+    Byte mDutyCycle;
 
-    /**
-    * Angle of the square
-    * wave function.
-    */
-    float mAngle;
+    /** Current step of the duty cycle */
+    Byte mSequenceStep;
 
 };
 
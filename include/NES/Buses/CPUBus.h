@@ -2,10 +2,12 @@
 #define CPUBUS_H
 
 #include <cstdint>
+#include <functional>
 
 #include "NES/PPU2C02/PPU2C02.h"
 #include "NES/APU/APU.h"
 #include "NES/Cartridge/Cartridge.h"
+#include "NES/Scheduler.h"
 
 #include "IO/Joypad.h"
 
@@ -17,7 +19,12 @@ class MOS6502;
 * NES bus. It connects 
 * all of the other components
 * and allows for their 
-* communication.
+* communication. Memory accesses
+* go through a table of 256 byte pages.
+* Pages backed by plain memory (RAM and
+* PRG ROM) point directly to it, all
+* other pages fall back to the register
+* handlers.
 * 
 * @see MOS6502
 * @see APU
@@ -44,11 +51,24 @@ public:
     *   the bus
     * @param joypad joypad object
     *   to be connected to the bus
-    * @param globalClock global clock
-    *   counter
+    * @param scheduler event scheduler
+    *   keeping the master clock
+    * @param ppuSyncCallback callback that
+    *   brings the PPU up to the current
+    *   master cycle, called before every
+    *   access to the PPU
+    * @param apuSyncCallback callback that
+    *   brings the APU up to the current
+    *   master cycle, called before every
+    *   access to the APU
     * 
+    * @see Scheduler
+    * @see mPpuSyncCallback
+    * @see mApuSyncCallback
     */
-    CPUBus(MOS6502& cpu, PPU2C02& ppu, APU& apu, Cartridge& cartridge, Joypad* joypads, Word& globalClock);
+    CPUBus(MOS6502& cpu, PPU2C02& ppu, APU& apu, Cartridge& cartridge, Joypad* joypads, 
+        const Scheduler& scheduler, std::function<void(void)> ppuSyncCallback,
+        std::function<void(void)> apuSyncCallback);
 
     /**
     * Performs a read from
@@ -60,7 +80,11 @@ public:
     * @return data read from the
     *   given address
     */
-    Byte read(const Word& address);
+    Byte read(const Word& address) {
+        const Byte* page = mReadPages[address >> 8];
+        if (page) { return page[address & 0xFF]; }
+        return this->readRegister(address);
+    }
 
     /**
     * Performs a write to
@@ -71,17 +95,91 @@ public:
     * @param address address to
     *   write the data to
     */
-    void write(const Byte& data, const Word& address);
+    void write(const Byte& data, const Word& address) {
+        Byte* page = mWritePages[address >> 8];
+        if (page) { page[address & 0xFF] = data; }
+        else { this->writeRegister(data, address); }
+    }
 
     /**
-    * Performs a dma transfer over
-    * 512 cpu cycles copying a whole
-    * page of CPU RAM to PPU VRAM.
+    * Performs a single cycle of the
+    * dma transfer, which copies a whole
+    * page of CPU RAM to PPU VRAM over
+    * 512 cpu cycles. Reads and writes
+    * alternate depending on the parity
+    * of the current master cycle.
     */
     void dmaTransfer(void);
 
+    /**
+    * Returns the CPU RAM. Unlike
+    * read(), it has no side effects,
+    * so it can be used to inspect
+    * the state of the emulation.
+    * 
+    * @return 2KB of CPU RAM
+    */
+    const Byte* getRam(void) const { return mRam; }
+
 private:
 
+    /**
+    * Performs a read from an
+    * address that isn't directly
+    * mapped in the page table.
+    * 
+    * @param address address to
+    *   read from
+    * 
+    * @return data read from the
+    *   given address
+    * 
+    * @see mReadPages
+    */
+    Byte readRegister(const Word& address);
+
+    /**
+    * Performs a write to an
+    * address that isn't directly
+    * mapped in the page table.
+    * 
+    * @param data data to be
+    *   written to the address
+    * @param address address to
+    *   write the data to
+    * 
+    * @see mWritePages
+    */
+    void writeRegister(const Byte& data, const Word& address);
+
+    /**
+    * Maps the pages of the
+    * cartridge space to the 
+    * currently selected PRG ROM
+    * banks and invalidates the 
+    * instructions decoded by the CPU.
+    * Called on every bank switch
+    * of the mapper.
+    * 
+    * @see Cartridge
+    * @see mReadPages
+    */
+    void mapPrgRomPages(void);
+
+    /**
+    * Pages of memory that can be
+    * read directly. Null pages are
+    * handled by readRegister().
+    */
+    const Byte* mReadPages[256];
+
+    /**
+    * Pages of memory that can be
+    * written directly. Null pages are
+    * handled by writeRegister().
+    */
+    Byte* mWritePages[256];
+
     /** An array representing the NES' 2KB RAM memory */
     Byte mRam[2048];
 
@@ -116,8 +214,24 @@ private:
     */
     Byte mDmaData;
 
-    /** Global clock counter */
-    Word* mGlobalClock;
+    /** Event scheduler keeping the master clock */
+    const Scheduler* mScheduler;
+
+    /**
+    * Callback synchronizing the PPU.
+    * The PPU runs behind the CPU and
+    * catches up only when the CPU
+    * is about to access it.
+    */
+    std::function<void(void)> mPpuSyncCallback;
+
+    /**
+    * Callback synchronizing the APU.
+    * Like the PPU, the APU runs behind
+    * the CPU and catches up only when 
+    * the CPU is about to access it.
+    */
+    std::function<void(void)> mApuSyncCallback;
 };
 
 #endif // !CPUBUS_H
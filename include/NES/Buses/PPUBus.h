@@ -4,6 +4,7 @@
 #include <cstdint>
 
 #include "NES/Cartridge/Cartridge.h"
+#include "NES/PPU2C02/ColourLUT.h"
 
 /**
 * A class that emulates
@@ -55,17 +56,127 @@ public:
     */
     void write(const Byte& data, Word address);
 
+    /**
+    * Returns the decoded row of
+    * a pattern table tile. The 
+    * address selects the row just
+    * like the address of its low
+    * bitplane would.
+    * 
+    * @param address pattern table
+    *   address of the row
+    * @param flipped true if the row
+    *   should be flipped horizontally
+    * 
+    * @return decoded tile row
+    * 
+    * @see TileRow
+    * @see mTilePages
+    */
+    const TileRow& readTileRow(const Word& address, const bool& flipped) const {
+        return mTilePages[(address >> 10) & 0x7][(address & 0x3F0) | (flipped ? 0x8 : 0) | (address & 0x7)];
+    }
+
+    /**
+    * Returns the colours of the
+    * palettes, already resolved
+    * to packed RGBA values with
+    * the current colour mode. 
+    * Entries are indexed like the
+    * palette memory at 0x3F00.
+    * 
+    * @return 32 resolved colours
+    * 
+    * @see setColourMode
+    */
+    const uint32_t* getPaletteColours(void) const { return mPaletteColours; }
+
+    /**
+    * Sets the colour mode the
+    * palette colours are
+    * resolved with.
+    * 
+    * @param grayscale true if only
+    *   the gray colours should be used
+    * @param emphasis colour emphasis
+    *   bits (red, green, blue from
+    *   the LSB)
+    * 
+    * @see getPaletteColours
+    */
+    void setColourMode(const bool& grayscale, const Byte& emphasis);
+
 private:
 
+    /**
+    * Resolves a palette entry
+    * to its packed RGBA colour.
+    * Entries of the background
+    * colour mirrors are resolved
+    * from the mirrored entries.
+    * 
+    * @param index index of the entry
+    * 
+    * @see mPaletteColours
+    */
+    void resolvePaletteColour(const Byte& index) {
+        Byte entry = index & 0x3 ? index : index & 0xC;
+        mPaletteColours[index] = mColours.rgba(mEmphasis, mPalette[entry] & mGrayscaleMask);
+    }
+
+    /**
+    * Points the nametable slots at
+    * the VRAM according to the
+    * current mirroring type of
+    * the cartridge.
+    * 
+    * @see mNametableSlots
+    */
+    void mapNametables(void);
+
+    /**
+    * Points the pattern table pages
+    * at the decoded tiles of the
+    * currently mapped CHR banks.
+    * 
+    * @see mTilePages
+    */
+    void mapChrPages(void);
+
     /** Cartridge component */
     Cartridge* mCartridge;
 
     /** Colour palettes */
     Byte mPalette[32];
 
+    /** 
+    * Colour palettes resolved to 
+    * packed RGBA colours, mirrors
+    * included.
+    */
+    uint32_t mPaletteColours[32];
+
+    /** Lookup table for the colours of the NES' PPU */
+    const ColourLUT mColours;
+
+    /** Mask applied to colour codes, 0x30 in grayscale */
+    Byte mGrayscaleMask;
+
+    /** Colour emphasis bits */
+    Byte mEmphasis;
+
+    /** Decoded tiles of each 1KB page of the pattern tables */
+    const TileRow* mTilePages[8];
+
     /** Nametable ram */
     Byte mNametable[2][1024];
 
+    /** 
+    * VRAM each of the four 1KB 
+    * nametables is mapped to
+    */
+    Byte* mNametableSlots[4];
+
 };
 
 #endif // ! PPUBUS_H
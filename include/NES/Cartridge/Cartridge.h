@@ -4,20 +4,27 @@
 #include <string>
 #include <vector>
 #include <cstdint>
+#include <functional>
 
 #include "NES/Cartridge/Mapper.h"
 
-/** 
-* Mirroring types. A mirroring 
-* type defines the layout of the
-* data inside the PPU VRAM.
+/**
+* A single row of a CHR tile
+* decoded for the PPU. It holds
+* both bitplanes of the row and
+* its pixels as 2 bit colour
+* indices, with the leftmost pixel
+* on the most significant bits.
 * 
-* @see PPU
+* @see Cartridge::getChrTilePage
 */
-enum Mirroring {
-    HORIZONTAL,
-    VERTICAL,
-    ALTERNATIVE
+struct TileRow {
+
+    /** Low and high bitplane */
+    uint8_t planes[2];
+
+    /** Packed 2 bit pixels */
+    uint16_t pixels;
 };
 
 /**
@@ -53,6 +60,33 @@ public:
     */ 
     Mirroring getMirroringType(void) { return mMirroring; }
 
+    /**
+    * Sets the callback called
+    * every time the mapper switches
+    * the nametable mirroring. The
+    * new type is already returned
+    * by getMirroringType when the
+    * callback is called.
+    * 
+    * @param callback mirroring 
+    *   switch callback
+    * 
+    * @see Mapper
+    */
+    void setMirroringCallback(std::function<void(void)> callback);
+
+    /**
+    * Returns the additional 2KB
+    * of nametable VRAM of the 
+    * cartridge. Only four-screen
+    * cartridges come with it.
+    * 
+    * @return pointer to the VRAM
+    *   or nullptr if the cartridge
+    *   has none
+    */
+    Byte* getNametableRam(void) { return mNametableRam.empty() ? nullptr : mNametableRam.data(); }
+
     /**
     * Returns the data read
     * from the given address 
@@ -66,6 +100,33 @@ public:
     */
     Byte readPrgRom(const Word& address);
 
+    /**
+    * Returns a pointer to the
+    * 256 byte block of PRG ROM that
+    * a given CPU memory page is
+    * currently mapped to.
+    * 
+    * @param page CPU memory page
+    *   (the high byte of the address)
+    * 
+    * @return pointer to the mapped
+    *   PRG ROM data or nullptr if the
+    *   cartridge has no PRG ROM
+    */
+    const Byte* getPrgRomPage(const Byte& page);
+
+    /**
+    * Sets the callback called
+    * every time the mapper switches
+    * the PRG ROM banks.
+    * 
+    * @param callback bank switch
+    *   callback
+    * 
+    * @see Mapper
+    */
+    void setBankSwitchCallback(std::function<void(void)> callback) { mMapper->setBankSwitchCallback(callback); }
+
     /**
     * Returns the data read
     * from the given address 
@@ -79,7 +140,65 @@ public:
     */
     Byte readChrRom(const Word& address);
 
+    /**
+    * Writes the data to a given
+    * address of CHR RAM and decodes
+    * the modified tile row again. 
+    * If the cartridge has CHR ROM
+    * the request is ignored.
+    * 
+    * @param data data to write
+    * @param address address to
+    *   write to
+    */
+    void writeChrRam(const Byte& data, const Word& address);
+
+    /**
+    * Returns a pointer to the decoded
+    * tiles of the 1KB block of CHR
+    * memory that a given 1KB page of
+    * the pattern tables is currently
+    * mapped to. Each of the 64 tiles
+    * takes 16 rows: 8 rows as stored
+    * followed by the same 8 rows
+    * flipped horizontally.
+    * 
+    * @param page page of the pattern
+    *   tables (address / 1KB)
+    * 
+    * @return pointer to the decoded
+    *   tile rows
+    * 
+    * @see TileRow
+    */
+    const TileRow* getChrTilePage(const Byte& page);
+
+    /**
+    * Sets the callback called
+    * every time the mapper switches
+    * the CHR banks.
+    * 
+    * @param callback bank switch
+    *   callback
+    * 
+    * @see Mapper
+    */
+    void setChrBankSwitchCallback(std::function<void(void)> callback) { mMapper->setChrBankSwitchCallback(callback); }
+
 private:
+
+    /**
+    * Decodes the tile row 
+    * containing a given byte
+    * of CHR memory.
+    * 
+    * @param offset offset of the
+    *   byte in the CHR memory
+    * 
+    * @see mChrTiles
+    */
+    void decodeChrRow(const size_t& offset);
+
     /** Cartridge's mapper type */
     Mapper* mMapper;
 
@@ -89,8 +208,17 @@ private:
     /** PRG ROM data */
     std::vector<Byte> mPrgRom;
 
-    /** CHR ROM data */
+    /** CHR ROM data, or CHR RAM if the cartridge has no CHR ROM */
     std::vector<Byte> mChrRom;
+
+    /** Flag indicating if the CHR memory is writable */
+    bool mChrRam;
+
+    /** CHR tiles decoded for the PPU */
+    std::vector<TileRow> mChrTiles;
+
+    /** Additional nametable VRAM of four-screen cartridges */
+    std::vector<Byte> mNametableRam;
 };
 
 #endif // !CARTRIDGE_H
@@ -2,6 +2,22 @@
 #define MAPPER_H
 
 #include <cstdint>
+#include <functional>
+
+/** 
+* Mirroring types. A mirroring 
+* type defines the layout of the
+* nametables inside the PPU VRAM.
+* 
+* @see PPUBus
+*/
+enum Mirroring {
+    HORIZONTAL,
+    VERTICAL,
+    ALTERNATIVE,    //four-screen, with 2KB of additional VRAM on the cartridge
+    SINGLE_SCREEN_A,
+    SINGLE_SCREEN_B
+};
 
 /**
 * Base class representing
@@ -51,13 +67,99 @@ public:
     */
     virtual Word mapChrRomAddr(const Word& address) = 0;
 
+    /**
+    * Sets the callback called
+    * every time the mapper switches
+    * the PRG ROM banks, so the 
+    * components caching pointers
+    * to the PRG ROM can update them.
+    * 
+    * @param callback bank switch
+    *   callback
+    * 
+    * @see mBankSwitchCallback
+    */
+    void setBankSwitchCallback(std::function<void(void)> callback) { mBankSwitchCallback = callback; }
+
+    /**
+    * Sets the callback called
+    * every time the mapper switches
+    * the CHR banks, so the components
+    * caching pointers to the decoded
+    * CHR tiles can update them.
+    * 
+    * @param callback bank switch
+    *   callback
+    * 
+    * @see mChrBankSwitchCallback
+    */
+    void setChrBankSwitchCallback(std::function<void(void)> callback) { mChrBankSwitchCallback = callback; }
+
+    /**
+    * Sets the callback called
+    * every time the mapper switches
+    * the nametable mirroring.
+    * 
+    * @param callback mirroring
+    *   switch callback
+    * 
+    * @see mMirroringCallback
+    */
+    void setMirroringCallback(std::function<void(Mirroring)> callback) { mMirroringCallback = callback; }
+
 protected:
 
+    /**
+    * Notifies the connected
+    * components about a PRG ROM
+    * bank switch. Mappers with
+    * switchable banks should call
+    * it after every switch.
+    * 
+    * @see mBankSwitchCallback
+    */
+    void bankSwitched(void) { if (mBankSwitchCallback) { mBankSwitchCallback(); } }
+
+    /**
+    * Notifies the connected
+    * components about a CHR bank
+    * switch. Mappers with switchable
+    * CHR banks should call it after
+    * every switch.
+    * 
+    * @see mChrBankSwitchCallback
+    */
+    void chrBankSwitched(void) { if (mChrBankSwitchCallback) { mChrBankSwitchCallback(); } }
+
+    /**
+    * Notifies the connected
+    * components about a change
+    * of the nametable mirroring.
+    * Mappers controlling the 
+    * mirroring should call it
+    * after every change.
+    * 
+    * @param mirroring new mirroring
+    *   type
+    * 
+    * @see mMirroringCallback
+    */
+    void mirroringSwitched(const Mirroring& mirroring) { if (mMirroringCallback) { mMirroringCallback(mirroring); } }
+
     /** PRG ROM size */
     Word mPrgRomSize;
 
     /** CHR ROM size */
     Word mChrRomSize;
+
+    /** Callback called on PRG ROM bank switches */
+    std::function<void(void)> mBankSwitchCallback;
+
+    /** Callback called on CHR bank switches */
+    std::function<void(void)> mChrBankSwitchCallback;
+
+    /** Callback called on mirroring switches */
+    std::function<void(Mirroring)> mMirroringCallback;
 };
 
 /**
@@ -3,13 +3,26 @@
 
 #include <cstdint>
 
-class MOS6502;
+#include "NES/MOS6502/MOS6502.h"
 
 /**
 * Base class for representing
-* MOS6502 addressing modes.
+* MOS6502 addressing modes. Like
+* operations, addressing modes hold
+* no state. Every one of them is a
+* class with two static methods:
+* fetchOperand(MOS6502&), which reads
+* the operand bytes following the opcode,
+* and resolve(MOS6502&, Word), which turns
+* the operand into the address of the
+* argument of the operation. Splitting
+* them lets the decoded instructions skip
+* the operand fetch. Each mode also tells
+* the number of its operand bytes and if
+* the argument is the accumulator.
 * 
 * @see MOS6502
+* @see Op
 */
 class AddressingMode {
 public:
@@ -17,18 +30,10 @@ public:
 	using Byte = uint8_t;
 	using Word = uint16_t;
 
-	/** 
-	* Adds cycles to the CPU
-	* clock.
-	* 
-	* @param cpu CPU to add
-	*	clock cycles to
-	* @param cycles number of
-	*	cycles to add
-	* 
-	* @see MOS6502
-	*/
-	void addCycles(MOS6502& cpu, const Byte& cycles);
+	/** Tells if the operation argument is the accumulator */
+	inline static constexpr bool ACCUMULATOR = false;
+
+protected:
 
 	/**
 	* Fetches a byte of data
@@ -43,7 +48,7 @@ public:
 	*	from the address pointed to
 	*	by the CPU's program counter
 	*/
-	Byte fetchByte(MOS6502& cpu);
+	static Byte fetchByte(MOS6502& cpu) { return cpu.fetchByte(); }
 
 	/**
 	* Fetches a byte of data
@@ -57,11 +62,15 @@ public:
 	* @return byte of data read
 	*	from the given address
 	*/
-	Byte fetchByte(MOS6502& cpu, const Word& address);
+	static Byte fetchByte(MOS6502& cpu, const Word& address) { return cpu.fetchByte(address); }
 
 	/**
 	* Returns the address of the
-	* CPU's program counter.
+	* CPU's program counter and
+	* increments it. This is a special
+	* case, when the address of data to
+	* be loaded is pointed to by the program
+	* counter, used only in IMM addressing.
 	* 
 	* @param cpu CPU to fetch
 	*	the program counter address
@@ -70,39 +79,37 @@ public:
 	* @return CPU's program counter 
 	*	address
 	*/
-	Word fetchFromProgramCounter(MOS6502& cpu);
+	static Word fetchFromProgramCounter(MOS6502& cpu) { return cpu.mProgramCounter++; }
 
 	/**
-	* Returns the parsed address 
-	* of the argument of the operation.
-	* 
-	* @param cpu CPU to fetch the operation
-	*	argument address from
+	* Fetches a word of data
+	* from the address pointed
+	* to by the CPU's program
+	* counter, low byte first.
 	* 
-	* @return operation argument address
-	*/
-	virtual Word getAddress(MOS6502& cpu) = 0;
-	
-	/**
-	* Returns the information
-	* if the memory page was
-	* crossed during fetching
-	* of the data.
+	* @param cpu CPU to fetch
+	*	the data from
 	* 
-	* @return flag indicating
-	*	if a memory page was
-	*	crossed
+	* @return word of data fetched
+	*	from the address pointed to
+	*	by the CPU's program counter
 	*/
-	static bool pageCrossed(void) { return AddressingMode::mPageCrossed; }
-
-protected:
+	static Word fetchWord(MOS6502& cpu) {
+		Byte low = fetchByte(cpu);
+		return (fetchByte(cpu) << 8) | low;
+	}
 
 	/**
-	* A flag to indicate if a
-	* memory page was crossed
+	* Sets the flag indicating
+	* if a memory page was crossed
 	* during the data fetch.
+	* 
+	* @param cpu CPU that executes
+	*	the instruction
+	* @param state new state of
+	*	the flag
 	*/
-	static bool mPageCrossed;
+	static void setPageCrossed(MOS6502& cpu, const bool& state) { cpu.mPageCrossed = state; }
 };
 
 /**
@@ -110,12 +117,14 @@ protected:
 */
 class UndefinedAddressingMode : public AddressingMode {
 public:
-	static UndefinedAddressingMode* getInstance(void);
-	Word getAddress(MOS6502& cpu);
+	inline static constexpr uint8_t OPERAND_BYTES = 0;
+
+	static Word fetchOperand(MOS6502& cpu) { return 0; }
 
-private:
-	UndefinedAddressingMode(void) = default;
-	static UndefinedAddressingMode* sInstance;
+	static Word resolve(MOS6502& cpu, const Word& operand) {
+		setPageCrossed(cpu, false);
+		return 0;
+	}
 };
 
 /**
@@ -123,12 +132,15 @@ private:
 */
 class ACC : public AddressingMode {
 public:
-	static ACC* getInstance(void);
-	Word getAddress(MOS6502& cpu);
+	inline static constexpr uint8_t OPERAND_BYTES = 0;
+	inline static constexpr bool ACCUMULATOR = true;
 
-private:
-	ACC(void) = default;
-	static ACC* sInstance;
+	static Word fetchOperand(MOS6502& cpu) { return 0; }
+
+	static Word resolve(MOS6502& cpu, const Word& operand) {
+		setPageCrossed(cpu, false);
+		return 0;
+	}
 };
 
 /**
@@ -136,12 +148,14 @@ private:
 */
 class IMP : public AddressingMode {
 public:
-	static IMP* getInstance(void);
-	Word getAddress(MOS6502& cpu);
+	inline static constexpr uint8_t OPERAND_BYTES = 0;
+
+	static Word fetchOperand(MOS6502& cpu) { return 0; }
 
-private:
-	IMP(void) = default;
-	static IMP* sInstance;
+	static Word resolve(MOS6502& cpu, const Word& operand) {
+		setPageCrossed(cpu, false);
+		return 0;
+	}
 };
 
 /**
@@ -149,12 +163,14 @@ private:
 */
 class IMM : public AddressingMode {
 public:
-	static IMM* getInstance(void);
-	Word getAddress(MOS6502& cpu);
+	inline static constexpr uint8_t OPERAND_BYTES = 1;
 
-private:
-	IMM(void) = default;
-	static IMM* sInstance;
+	static Word fetchOperand(MOS6502& cpu) { return fetchFromProgramCounter(cpu); }
+
+	static Word resolve(MOS6502& cpu, const Word& operand) {
+		setPageCrossed(cpu, false);
+		return cpu.getProgramCounter() - 1; //the operand is the byte right before the program counter
+	}
 };
 
 /**
@@ -162,12 +178,14 @@ private:
 */
 class ZP0 : public AddressingMode {
 public:
-	static ZP0* getInstance(void);
-	Word getAddress(MOS6502& cpu);
+	inline static constexpr uint8_t OPERAND_BYTES = 1;
+
+	static Word fetchOperand(MOS6502& cpu) { return fetchByte(cpu); }
 
-private:
-	ZP0(void) = default;
-	static ZP0* sInstance;
+	static Word resolve(MOS6502& cpu, const Word& operand) {
+		setPageCrossed(cpu, false);
+		return operand;
+	}
 };
 
 /**
@@ -175,12 +193,14 @@ private:
 */
 class ZPX : public AddressingMode {
 public:
-	static ZPX* getInstance(void);
-	Word getAddress(MOS6502& cpu);
+	inline static constexpr uint8_t OPERAND_BYTES = 1;
 
-private:
-	ZPX(void) = default;
-	static ZPX* sInstance;
+	static Word fetchOperand(MOS6502& cpu) { return fetchByte(cpu); }
+
+	static Word resolve(MOS6502& cpu, const Word& operand) {
+		setPageCrossed(cpu, false);
+		return 0 | Byte(operand + cpu.getX());
+	}
 };
 
 /**
@@ -188,12 +208,14 @@ private:
 */
 class ZPY : public AddressingMode {
 public:
-	static ZPY* getInstance(void);
-	Word getAddress(MOS6502& cpu);
+	inline static constexpr uint8_t OPERAND_BYTES = 1;
+
+	static Word fetchOperand(MOS6502& cpu) { return fetchByte(cpu); }
 
-private:
-	ZPY(void) = default;
-	static ZPY* sInstance;
+	static Word resolve(MOS6502& cpu, const Word& operand) {
+		setPageCrossed(cpu, false);
+		return 0 | Byte(operand + cpu.getY());
+	}
 };
 
 /**
@@ -201,12 +223,15 @@ private:
 */
 class REL : public AddressingMode {
 public:
-	static REL* getInstance(void);
-	Word getAddress(MOS6502& cpu);
+	inline static constexpr uint8_t OPERAND_BYTES = 1;
 
-private:
-	REL(void) = default;
-	static REL* sInstance;
+	static Word fetchOperand(MOS6502& cpu) { return fetchByte(cpu); }
+
+	static Word resolve(MOS6502& cpu, const Word& operand) {
+		setPageCrossed(cpu, false);
+		signed char offset = (Byte)operand;
+		return cpu.getProgramCounter() + offset;
+	}
 };
 
 /**
@@ -214,12 +239,14 @@ private:
 */
 class ABS : public AddressingMode {
 public:
-	static ABS* getInstance(void);
-	Word getAddress(MOS6502& cpu);
+	inline static constexpr uint8_t OPERAND_BYTES = 2;
+
+	static Word fetchOperand(MOS6502& cpu) { return fetchWord(cpu); }
 
-private:
-	ABS(void) = default;
-	static ABS* sInstance;
+	static Word resolve(MOS6502& cpu, const Word& operand) {
+		setPageCrossed(cpu, false);
+		return operand;
+	}
 };
 
 /**
@@ -227,12 +254,15 @@ private:
 */
 class ABX : public AddressingMode {
 public:
-	static ABX* getInstance(void);
-	Word getAddress(MOS6502& cpu);
+	inline static constexpr uint8_t OPERAND_BYTES = 2;
 
-private:
-	ABX(void) = default;
-	static ABX* sInstance;
+	static Word fetchOperand(MOS6502& cpu) { return fetchWord(cpu); }
+
+	static Word resolve(MOS6502& cpu, const Word& operand) {
+		Word address = operand + cpu.getX();
+		setPageCrossed(cpu, Byte(address >> 8) != Byte(operand >> 8));
+		return address;
+	}
 };
 
 /**
@@ -240,12 +270,15 @@ private:
 */
 class ABY : public AddressingMode {
 public:
-	static ABY* getInstance(void);
-	Word getAddress(MOS6502& cpu);
+	inline static constexpr uint8_t OPERAND_BYTES = 2;
+
+	static Word fetchOperand(MOS6502& cpu) { return fetchWord(cpu); }
 
-private:
-	ABY(void) = default;
-	static ABY* sInstance;
+	static Word resolve(MOS6502& cpu, const Word& operand) {
+		Word address = operand + cpu.getY();
+		setPageCrossed(cpu, Byte(address >> 8) != Byte(operand >> 8));
+		return address;
+	}
 };
 
 /**
@@ -253,12 +286,18 @@ private:
 */
 class IND : public AddressingMode {
 public:
-	static IND* getInstance(void);
-	Word getAddress(MOS6502& cpu);
-
-private:
-	IND(void) = default;
-	static IND* sInstance;
+	inline static constexpr uint8_t OPERAND_BYTES = 2;
+
+	static Word fetchOperand(MOS6502& cpu) { return fetchWord(cpu); }
+
+	static Word resolve(MOS6502& cpu, const Word& operand) {
+		setPageCrossed(cpu, false);
+		Byte lowIndirect = (Byte)operand;
+		Word highIndirect = operand & 0xFF00;
+		Word lowDirect = operand;
+		Word highDirect = highIndirect | Byte(lowIndirect + 1); //this is a known bug -- when jumping to 0x**FF, the CPU will read 0x**FF and 0x**00
+		return (fetchByte(cpu, highDirect) << 8) | fetchByte(cpu, lowDirect);
+	}
 };
 
 /**
@@ -266,12 +305,16 @@ private:
 */
 class IDX : public AddressingMode {
 public:
-	static IDX* getInstance(void);
-	Word getAddress(MOS6502& cpu);
+	inline static constexpr uint8_t OPERAND_BYTES = 1;
+
+	static Word fetchOperand(MOS6502& cpu) { return fetchByte(cpu); }
 
-private:
-	IDX(void) = default;
-	static IDX* sInstance;
+	static Word resolve(MOS6502& cpu, const Word& operand) {
+		setPageCrossed(cpu, false);
+		Byte zpAddress = operand + cpu.getX();
+		Byte lowDirect = fetchByte(cpu, zpAddress);
+		return (fetchByte(cpu, Byte(zpAddress + 1)) << 8) | lowDirect;
+	}
 };
 
 /**
@@ -279,12 +322,18 @@ private:
 */
 class IDY : public AddressingMode {
 public:
-	static IDY* getInstance(void);
-	Word getAddress(MOS6502& cpu);
-
-private:
-	IDY(void) = default;
-	static IDY* sInstance;
+	inline static constexpr uint8_t OPERAND_BYTES = 1;
+
+	static Word fetchOperand(MOS6502& cpu) { return fetchByte(cpu); }
+
+	static Word resolve(MOS6502& cpu, const Word& operand) {
+		Byte zpAddress = (Byte)operand;
+		Word lowDirect = fetchByte(cpu, zpAddress);
+		Word highDirect = fetchByte(cpu, Byte(zpAddress + 1)); //same overflow bug
+		Word address = ((highDirect << 8) | lowDirect) + cpu.getY();
+		setPageCrossed(cpu, Byte(address >> 8) != highDirect);
+		return address;
+	}
 };
 
 #endif // !ADDRESING_MODE_H
@@ -0,0 +1,157 @@
+#ifndef BLOCK_CACHE_H
+#define BLOCK_CACHE_H
+
+#include <cstdint>
+#include <vector>
+
+#include "NES/MOS6502/InstructionCache.h"
+
+class CPUBus;
+
+/**
+* Basic block compiled
+* from the program memory.
+* 
+* @see BlockCache
+*/
+struct CompiledBlock {
+	uint32_t first;			//index of the first instruction of the block
+	uint16_t count;			//number of instructions in the block
+	uint16_t maxCycles;		//upper bound of the cycles taken by the whole block
+	uint32_t generation;	//generation of the cache the block was compiled in
+};
+
+/**
+* Cache of basic blocks compiled
+* from the PRG ROM. A basic block is
+* a straight run of instructions which
+* ends with the first instruction that
+* can change the flow of the program.
+* The decoded instructions of a block
+* are stored one after another, so the
+* CPU executes the whole block in a tight
+* loop (threaded code). Each block also
+* knows how many cycles it can take at
+* most, so the CPU can skip checking
+* its cycle budget after every instruction
+* when the whole block fits in it. Like
+* the instruction cache, the blocks are
+* tagged with the cache generation.
+* 
+* @see InstructionCache
+* @see MOS6502
+*/
+class BlockCache {
+public:
+
+	using Byte = uint8_t;
+	using Word = uint16_t;
+
+	/** Maximum number of instructions in a single block */
+	inline static constexpr uint16_t MAX_BLOCK_LENGTH = 64;
+
+	/**
+	* Class constructor. Initializes
+	* an instance of the class with
+	* no compiled blocks.
+	* 
+	* @param instructionCache cache
+	*	decoding the instructions of
+	*	the blocks
+	*/
+	BlockCache(InstructionCache& instructionCache);
+
+	/**
+	* Returns the information
+	* if the block starting at a
+	* given address can be cached.
+	* 
+	* @param address start address
+	*	of the block
+	* 
+	* @return true if the address
+	*	is covered by the cache
+	*/
+	static bool isCached(const Word& address) { return InstructionCache::isCached(address); }
+
+	/**
+	* Returns the block starting at
+	* a given address, compiling it if
+	* it isn't in the cache yet.
+	* 
+	* @param bus bus to read the
+	*	instructions from
+	* @param address start address 
+	*	of the block, has to be covered
+	*	by the cache
+	* 
+	* @return compiled block
+	* 
+	* @see isCached
+	*/
+	const CompiledBlock& fetch(CPUBus& bus, const Word& address) {
+		CompiledBlock& block = mBlocks[address - InstructionCache::START];
+		if (block.generation != mGeneration) { this->compile(bus, address, block); }
+		return block;
+	}
+
+	/**
+	* Returns the instructions of
+	* a given block. The pointer stays
+	* valid until the next block is
+	* compiled.
+	* 
+	* @param block compiled block
+	* 
+	* @return pointer to the first
+	*	instruction of the block
+	*/
+	const CachedInstruction* getInstructions(const CompiledBlock& block) const { return &mInstructions[block.first]; }
+
+	/**
+	* Invalidates all of the
+	* compiled blocks.
+	*/
+	void invalidate(void);
+
+	/**
+	* Returns the current generation
+	* of the cache. It changes every
+	* time the blocks get invalidated,
+	* after which the instructions of
+	* a block being executed are stale.
+	* 
+	* @return cache generation
+	*/
+	uint32_t getGeneration(void) const { return mGeneration; }
+
+private:
+
+	/**
+	* Compiles the block starting
+	* at a given address.
+	* 
+	* @param bus bus to read the
+	*	instructions from
+	* @param address start address
+	*	of the block
+	* @param block entry to store
+	*	the compiled block in
+	*/
+	void compile(CPUBus& bus, const Word& address, CompiledBlock& block);
+
+	/** Cache decoding the instructions */
+	InstructionCache* mInstructionCache;
+
+	/** Blocks, one for each cached start address */
+	std::vector<CompiledBlock> mBlocks;
+
+	/** Instructions of all the compiled blocks */
+	std::vector<CachedInstruction> mInstructions;
+
+	/** Current generation of the cache */
+	uint32_t mGeneration;
+
+};
+
+#endif // !BLOCK_CACHE_H
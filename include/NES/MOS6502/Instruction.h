@@ -1,112 +1,83 @@
 #ifndef  INSTRUCTION_H
 #define INSTRUCTION_H
 
-#include <string>
 #include <cstdint>
 
+#include "NES/MOS6502/MOS6502.h"
 #include "NES/MOS6502/Operation.h"
 #include "NES/MOS6502/AddressingMode.h"
 
-class MOS6502;
+/**
+* Pointer to a function executing
+* a single MOS6502 instruction.
+* 
+* @see Op
+*/
+using Instruction = void (*)(MOS6502& cpu);
 
 /**
-* Class that consists of 
-* an operation and an 
-* addressing mode.
+* Class template that consists
+* of an operation, an addressing
+* mode and a cost in CPU cycles.
+* Each opcode is a separate
+* instantiation of the template,
+* so the whole instruction is known
+* at compile time and the compiler
+* is free to inline the addressing
+* mode and the operation into it.
 * 
 * @see AddressingMode
 * @see Operation
 */
-class Instruction {
+template<class Operation, class AddressingMode, uint8_t Cycles>
+class Op {
+public:
 
-	friend class OpcodeLUT;
+	/** Cost of the instruction in CPU cycles */
+	inline static constexpr uint8_t CYCLES = Cycles;
 
-public:
+	/** Length of the instruction in bytes, including the opcode */
+	inline static constexpr uint8_t LENGTH = 1 + AddressingMode::OPERAND_BYTES;
 
-	using Byte = uint8_t;
-	using Word = uint16_t;
+	/** Tells if the instruction can change the flow of the program */
+	inline static constexpr bool CONTROL_FLOW = Operation::CONTROL_FLOW;
 
 	/**
-	* Executes and operation
-	* stored in the instruction.
+	* Executes the instruction.
+	* Fetches the operand from the
+	* program memory and executes
+	* the instruction with it.
 	* 
 	* @param cpu CPU that executes
-	*	the operation
+	*	the instruction
 	* 
 	* @see MOS6502
 	*/
-	void execute(MOS6502& cpu);
-
-	/**
-	* Returns the type of
-	* addressing mode of
-	* the operation.
-	* 
-	* @return operation's
-	*	addressing mode
-	*/
-	static AddressingMode* getAddressingMode(void) { return sAddressingMode; }
-
-private:
-
-	/**
-	* Class constructor. Creates
-	* an instance of the class
-	* with default parameters.
-	*/
-	Instruction(void) :
-		mLabel(""),
-		mOperation(UndefinedOperation::getInstance()),
-		mAddressingMode(UndefinedAddressingMode::getInstance()),
-		mCycles(0)
-	{}
+	static void execute(MOS6502& cpu) { executeDecoded(cpu, AddressingMode::fetchOperand(cpu)); }
 
 	/**
-	* Class constructor. Creates
-	* an instance of the class
-	* with given parameters.
-	* 
-	* @param label a label of
-	*	the instruction
-	* @param operation operation
-	*	type of the instruction
-	* @param addressingMode addressing
-	*	mode type of the instruction
-	* @param cycles cost of the instruction
-	*	in CPU cycles
-	*/
-	Instruction(const std::string& label, Operation* operation, AddressingMode* addresingMode, const Byte& cycles) :
-		mLabel(label),
-		mOperation(operation),
-		mAddressingMode(addresingMode),
-		mCycles(cycles)
-	{}
-
-	void operator=(const Instruction& other);
-
-	/**
-	* Fetches the address of the
-	* argument of the operation.
+	* Executes the instruction with
+	* an already fetched operand. The
+	* program counter has to point past
+	* the instruction. Resolves the address
+	* of the argument of the operation,
+	* executes the operation and adds the
+	* instruction's cycles to the CPU
+	* cycle counter.
 	* 
 	* @param cpu CPU that executes
 	*	the instruction
+	* @param operand operand of
+	*	the instruction
+	* 
+	* @see MOS6502
 	*/
-	void fetchAddress(MOS6502& cpu);
-
-	/** Instruction label */
-	std::string mLabel;
-
-	/** Operation type of the instruction */
-	Operation* mOperation;
-
-	/** Addressing mode type of the instruction */
-	AddressingMode* mAddressingMode;
-
-	/** Cost of the operation in CPU cycles */
-	Byte mCycles;
-
-	/** Pointer to the addressing mode type */
-	static AddressingMode* sAddressingMode;
+	static void executeDecoded(MOS6502& cpu, const uint16_t& operand) {
+		cpu.setFetchedAddress(AddressingMode::resolve(cpu, operand));
+		cpu.setAccAddressing(AddressingMode::ACCUMULATOR);
+		Operation::execute(cpu);
+		cpu.addCycles(Cycles);
+	}
 };
 
 #endif // ! INSTRUCTION_H
@@ -0,0 +1,132 @@
+#ifndef INSTRUCTION_CACHE_H
+#define INSTRUCTION_CACHE_H
+
+#include <cstdint>
+#include <vector>
+
+class MOS6502;
+class CPUBus;
+
+/**
+* Pointer to a function executing
+* a single MOS6502 instruction with
+* an already fetched operand.
+* 
+* @see Op
+* @see InstructionCache
+*/
+using DecodedInstruction = void (*)(MOS6502& cpu, const uint16_t& operand);
+
+/**
+* Instruction decoded from
+* the program memory.
+* 
+* @see InstructionCache
+*/
+struct CachedInstruction {
+	DecodedInstruction execute;	//instruction taking the decoded operand
+	uint16_t operand;			//operand bytes following the opcode
+	uint8_t length;				//length of the instruction in bytes, including the opcode
+	uint8_t cycles;				//base cost of the instruction in CPU cycles
+	uint32_t generation;		//generation of the cache the instruction was decoded in
+};
+
+/**
+* Cache of instructions decoded
+* from the PRG ROM. Every address
+* of the cartridge space has its own
+* entry, decoded the first time the
+* CPU executes it. Later executions
+* skip fetching and decoding of the
+* opcode and the operand. The entries
+* are tagged with the generation of
+* the cache, so invalidating all of
+* them on a bank switch only takes
+* a single increment.
+* 
+* @see MOS6502
+* @see CPUBus
+*/
+class InstructionCache {
+public:
+
+	using Byte = uint8_t;
+	using Word = uint16_t;
+
+	/** First cached address */
+	inline static constexpr Word START = 0x8000;
+
+	/** Last cached address, the last one where a 3 byte instruction fits */
+	inline static constexpr Word END = 0xFFFD;
+
+	/**
+	* Class constructor. Initializes
+	* an instance of the class with
+	* no decoded instructions.
+	*/
+	InstructionCache(void);
+
+	/**
+	* Returns the information
+	* if the instruction at a given
+	* address can be cached.
+	* 
+	* @param address address of
+	*	the instruction
+	* 
+	* @return true if the address
+	*	is covered by the cache
+	*/
+	static bool isCached(const Word& address) { return address >= START && address <= END; }
+
+	/**
+	* Returns the instruction at
+	* a given address, decoding it
+	* if it isn't in the cache yet.
+	* 
+	* @param bus bus to read the
+	*	instruction from
+	* @param address address of 
+	*	the instruction, has to be
+	*	covered by the cache
+	* 
+	* @return decoded instruction
+	* 
+	* @see isCached
+	*/
+	const CachedInstruction& fetch(CPUBus& bus, const Word& address) {
+		CachedInstruction& instruction = mInstructions[address - START];
+		if (instruction.generation != mGeneration) { this->decode(bus, address, instruction); }
+		return instruction;
+	}
+
+	/**
+	* Invalidates all of the
+	* decoded instructions.
+	*/
+	void invalidate(void);
+
+private:
+
+	/**
+	* Decodes the instruction at 
+	* a given address.
+	* 
+	* @param bus bus to read the
+	*	instruction from
+	* @param address address of 
+	*	the instruction
+	* @param instruction entry to
+	*	store the decoded instruction in
+	*/
+	void decode(CPUBus& bus, const Word& address, CachedInstruction& instruction);
+
+	/** Decoded instructions, one for each cached address */
+	std::vector<CachedInstruction> mInstructions;
+
+	/** Current generation of the cache */
+	uint32_t mGeneration;
+
+};
+
+#endif // !INSTRUCTION_CACHE_H
@@ -3,7 +3,8 @@
 
 #include <cstdint>
 
-#include "NES/MOS6502/OpcodeLUT.h"
+#include "NES/MOS6502/InstructionCache.h"
+#include "NES/MOS6502/BlockCache.h"
 #include "NES/Buses/CPUBus.h"
 
 /**
@@ -15,7 +16,7 @@
 * 
 * @see MOS6502
 */
-enum ProcessorFlag {
+enum ProcessorFlag : uint8_t {
 	FLAG_CARRY = 1,
 	FLAG_ZERO = 1 << 1,
 	FLAG_INTERRUPT_DISABLE = 1 << 2,
@@ -36,14 +37,17 @@ enum ProcessorFlag {
 class MOS6502 {
 
 	friend class Operation;
-	friend class Instruction;
 	friend class AddressingMode;
+	template<class Operation, class AddressingMode, uint8_t Cycles> friend class Op;
 
 public:
 
 	using Byte = uint8_t;
 	using Word = uint16_t;
 
+	/** Number of cycles taken by the reset sequence */
+	inline static constexpr unsigned int RESET_CYCLES = 8;
+
 	/**
 	* Class constructor. Initializes
 	* an instance of the class with
@@ -66,15 +70,42 @@ public:
 	void boot(CPUBus& bus);
 
 	/**
-	* Clocks the CPU by decreasing
-	* the clock counter. When the
-	* counter reaches 0 the next 
-	* instruction is executed.
+	* Executes the next instruction
+	* pointed to by the program counter.
+	* The instruction is executed at
+	* once and the caller is responsible
+	* for waiting the returned number
+	* of cycles before the next step.
 	* 
-	* @see Instruction
+	* @return number of CPU cycles
+	*	taken by the instruction
+	* 
+	* @see OpcodeLUT
 	* @see mCycles
 	*/
-	void clock(void);
+	unsigned int step(void) { return this->run(1); }
+
+	/**
+	* Executes instructions until
+	* they take at least a given number
+	* of cycles or until one of them
+	* starts the DMA transfer. The 
+	* instructions are executed at once
+	* and the caller is responsible for
+	* waiting the returned number of 
+	* cycles before the next run. During
+	* the run, getRunCycles() tells how
+	* far the CPU has got.
+	* 
+	* @param budget number of cycles
+	*	to run for
+	* 
+	* @return number of CPU cycles
+	*	taken by the instructions
+	* 
+	* @see mRunCycles
+	*/
+	unsigned int run(const unsigned int& budget);
 
 	/**
 	* Starts a non-maskable
@@ -105,6 +136,30 @@ public:
 	*/
 	void stopDmaTransfer(void) { mDmaTransferOn = false; }
 
+	/**
+	* Returns the information if
+	* the DMA transfer is running.
+	* 
+	* @return true if the DMA
+	*	transfer is running
+	* 
+	* @see mDmaTransferOn
+	*/
+	bool isDmaTransferOn(void) const { return mDmaTransferOn; }
+
+	/**
+	* Invalidates all of the
+	* decoded instructions. Has to
+	* be called every time the 
+	* program memory changes.
+	* 
+	* @see mInstructionCache
+	*/
+	void invalidateInstructionCache(void) { 
+		mInstructionCache.invalidate(); 
+		mBlockCache.invalidate();
+	}
+
 	/**
 	* Returns the value of the 
 	* temporary fetched data address
@@ -141,13 +196,41 @@ public:
 	bool isAccAddressed(void) { return mAccAddressing; }
 
 	/**
-	* Returns the value stored
-	* in the cycle counter.
+	* Returns the number of cycles
+	* taken by the last executed
+	* instruction.
 	* 
 	* @return value of the cycle
 	*	counter
 	*/
-	Byte getCycles(void) const { return mCycles; }
+	unsigned int getCycles(void) const { return mCycles; }
+
+	/**
+	* Returns the number of cycles
+	* taken by the instructions of the
+	* current run, which were executed
+	* before the current instruction.
+	* Outside of a run it's always 0.
+	* 
+	* @return value of the run
+	*	cycle counter
+	* 
+	* @see run
+	*/
+	unsigned int getRunCycles(void) const { return mRunCycles; }
+
+	/**
+	* Returns the number of cycles
+	* the CPU has skipped in idle
+	* loops since the boot.
+	* 
+	* @return value of the idle
+	*	cycle counter
+	* 
+	* @see skipIdleLoop
+	* @see mIdleCycles
+	*/
+	unsigned long long getIdleCycles(void) const { return mIdleCycles; }
 
 	/**
 	* Returns the data stored
@@ -217,9 +300,67 @@ private:
 	/**
 	* Executes the next instruction
 	* pointed to by the program counter.
+	* Depending on the execution core,
+	* it may execute several of them
+	* as long as the run isn't over.
+	* 
+	* @see isRunOver
 	*/
 	void executeInstruction(void);
 
+	/**
+	* Adds the cycles of the last
+	* executed instruction to the
+	* run cycle counter.
+	* 
+	* @see mRunCycles
+	*/
+	void retireInstruction(void) {
+		if (!mCycles) { mCycles = 256; } //undefined opcodes take no cycles and the counter wraps around
+		mRunCycles += mCycles;
+	}
+
+	/**
+	* Returns the information
+	* if the current run is over.
+	* 
+	* @return true if the run
+	*	budget is spent or the
+	*	DMA transfer has started
+	* 
+	* @see run
+	*/
+	bool isRunOver(void) const { return mRunCycles >= mRunBudget || mDmaTransferOn; }
+
+	/**
+	* Checks if the program counter
+	* points at an idle loop, which only
+	* waits for the next interrupt, and
+	* skips its iterations up to the end
+	* of the run. Recognized loops are
+	* JMP to itself, LDA/BIT $2002 with
+	* BPL waiting for the vblank flag
+	* and LDA from the zero page with
+	* BEQ/BNE waiting for the NMI handler
+	* to change the value. Nothing they
+	* read can change before the next 
+	* event, so the skipped iterations
+	* are only credited with their cycles
+	* and the last ones are executed as
+	* usual, leaving the CPU in the exact
+	* state it would end up in otherwise.
+	* The loop must have just been run
+	* from its first instruction, so its
+	* flags come from its own read.
+	* Building with NES_CPU_NO_IDLE_SKIP
+	* runs every iteration instead, the
+	* tests compare the two.
+	* 
+	* @see run
+	* @see mIdleCycles
+	*/
+	void skipIdleLoop(void);
+
 	/**
 	* Fetches the data from
 	* the address pointed
@@ -227,7 +368,7 @@ private:
 	* 
 	* @return fetched data
 	*/
-	Byte fetchByte(void);
+	Byte fetchByte(void) { return mBus->read(mProgramCounter++); }
 
 	/**
 	* Fetches the data from
@@ -238,7 +379,7 @@ private:
 	* 
 	* @return fetched data
 	*/
-	Byte fetchByte(const Word& address);
+	Byte fetchByte(const Word& address) { return mBus->read(address); }
 
 	/**
 	* Fetches a value from
@@ -247,7 +388,7 @@ private:
 	* @return data fetched
 	*	from the stack
 	*/
-	Byte fetchStack(void);
+	Byte fetchStack(void) { return mBus->read(0x100 + (++mStackPointer)); } //stkptr will be incremented before the read
 
 	/**
 	* Pushes a given value
@@ -256,7 +397,7 @@ private:
 	* @param data data to be 
 	*	pushed on the stack
 	*/
-	void pushStack(const Byte& data);
+	void pushStack(const Byte& data) { mBus->write(data, 0x100 + mStackPointer--); } //stkptr will be decremented after the write
 
 	/**
 	* Writes a byte of data
@@ -267,7 +408,7 @@ private:
 	* @param address address to
 	*	write the data to
 	*/
-	void writeMemory(const Byte& data, const Word& address);
+	void writeMemory(const Byte& data, const Word& address) { mBus->write(data, address); }
 
 	/**
 	* Adds cycles to the
@@ -279,7 +420,7 @@ private:
 	* 
 	* @see mCycles
 	*/
-	void addCycles(const Byte& cycles) { mCycles += cycles; }
+	void addCycles(const unsigned int& cycles) { mCycles += cycles; }
 
 	/**
 	* Sets the accumulator
@@ -373,7 +514,10 @@ private:
 	* 
 	* @see mStatusRegister
 	*/
-	void setFlag(const ProcessorFlag& flag, const bool& value);
+	void setFlag(const ProcessorFlag& flag, const bool& value) {
+		if (value) { mStatusRegister |= flag; } 
+		else { mStatusRegister &= ~flag; }
+	}
 
 	/**
 	* Sets the processor status
@@ -389,11 +533,23 @@ private:
 	/** Main NES bus */
 	CPUBus* mBus;
 
-	/** Lookup table for supported opcodes */
-	OpcodeLUT mOpcodes;
+	/** Cache of instructions decoded from the PRG ROM */
+	InstructionCache mInstructionCache;
+
+	/** Cache of basic blocks compiled from the PRG ROM */
+	BlockCache mBlockCache;
 
 	/** Internal cycle counter */
-	Byte mCycles;
+	unsigned int mCycles;
+
+	/** Cycles taken by the current run */
+	unsigned int mRunCycles;
+
+	/** Cycles the current run should take */
+	unsigned int mRunBudget;
+
+	/** Cycles skipped in idle loops */
+	unsigned long long mIdleCycles;
 
 	/**
 	* Temporary register for storing
@@ -408,6 +564,14 @@ private:
 	*/
 	bool mAccAddressing;
 
+	/**
+	* A flag to determine if a
+	* memory page was crossed
+	* while fetching the address
+	* of the loaded data.
+	*/
+	bool mPageCrossed;
+
 	/**
 	* A flag to determine if the
 	* DMA transfer is currently
@@ -1,304 +1,322 @@
 #ifndef OPCODE_LUT_H
 #define OPCODE_LUT_H
 
-#include <cstdio>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
 
 #include "NES/MOS6502/Instruction.h"
 #include "NES/MOS6502/Operation.h"
 #include "NES/MOS6502/AddressingMode.h"
 
+/**
+* Compile time description of
+* a MOS6502 opcode. The primary
+* template describes undefined
+* opcodes, every supported opcode
+* has its own specialization naming
+* the instruction and its label.
+* 
+* @see Op
+* @see OpcodeLUT
+*/
+template<uint8_t Code>
+struct Opcode {
+    using Type = Op<UndefinedOperation, UndefinedAddressingMode, 0>;
+    inline static constexpr const char* LABEL = "Undefined";
+};
+
+template<> struct Opcode<0x00> { using Type = Op<BRK, IMP, 7>; inline static constexpr const char* LABEL = "BRK"; };
+template<> struct Opcode<0x01> { using Type = Op<ORA, IDX, 6>; inline static constexpr const char* LABEL = "ORA indirect X"; };
+template<> struct Opcode<0x05> { using Type = Op<ORA, ZP0, 3>; inline static constexpr const char* LABEL = "ORA Zero Page"; };
+template<> struct Opcode<0x06> { using Type = Op<ASL, ZP0, 5>; inline static constexpr const char* LABEL = "ASL Zero Page"; };
+template<> struct Opcode<0x08> { using Type = Op<PHP, IMP, 3>; inline static constexpr const char* LABEL = "PHP"; };
+template<> struct Opcode<0x09> { using Type = Op<ORA, IMM, 2>; inline static constexpr const char* LABEL = "ORA Immediate"; };
+template<> struct Opcode<0x0A> { using Type = Op<ASL, ACC, 2>; inline static constexpr const char* LABEL = "ASL Accumulator"; };
+template<> struct Opcode<0x0D> { using Type = Op<ORA, ABS, 4>; inline static constexpr const char* LABEL = "ORA Absolute"; };
+template<> struct Opcode<0x0E> { using Type = Op<ASL, ABS, 6>; inline static constexpr const char* LABEL = "ASL Absolute"; };
+template<> struct Opcode<0x10> { using Type = Op<BPL, REL, 2>; inline static constexpr const char* LABEL = "BPL"; };
+template<> struct Opcode<0x11> { using Type = Op<ORA, IDY, 5>; inline static constexpr const char* LABEL = "ORA (Indirect),Y"; };
+template<> struct Opcode<0x15> { using Type = Op<ORA, ZPX, 4>; inline static constexpr const char* LABEL = "ORA Zero Page,X"; };
+template<> struct Opcode<0x16> { using Type = Op<ASL, ZPX, 6>; inline static constexpr const char* LABEL = "ASL Zero Page,X"; };
+template<> struct Opcode<0x18> { using Type = Op<CLC, IMP, 2>; inline static constexpr const char* LABEL = "CLC"; };
+template<> struct Opcode<0x19> { using Type = Op<ORA, ABY, 4>; inline static constexpr const char* LABEL = "ORA Absolute,Y"; };
+template<> struct Opcode<0x1D> { using Type = Op<ORA, ABX, 4>; inline static constexpr const char* LABEL = "ORA Absolute,X"; };
+template<> struct Opcode<0x1E> { using Type = Op<ASL, ABX, 7>; inline static constexpr const char* LABEL = "ASL Absolute,X"; };
+template<> struct Opcode<0x20> { using Type = Op<JSR, ABS, 6>; inline static constexpr const char* LABEL = "JSR Absolute"; };
+template<> struct Opcode<0x21> { using Type = Op<AND, IDX, 6>; inline static constexpr const char* LABEL = "AND (Indirect,X)"; };
+template<> struct Opcode<0x24> { using Type = Op<BIT, ZP0, 3>; inline static constexpr const char* LABEL = "BIT Zero Page"; };
+template<> struct Opcode<0x25> { using Type = Op<AND, ZP0, 3>; inline static constexpr const char* LABEL = "AND Zero Page"; };
+template<> struct Opcode<0x26> { using Type = Op<ROL, ZP0, 5>; inline static constexpr const char* LABEL = "ROL Zero Page"; };
+template<> struct Opcode<0x28> { using Type = Op<PLP, IMP, 4>; inline static constexpr const char* LABEL = "PLP"; };
+template<> struct Opcode<0x29> { using Type = Op<AND, IMM, 2>; inline static constexpr const char* LABEL = "AND Immediate"; };
+template<> struct Opcode<0x2A> { using Type = Op<ROL, ACC, 2>; inline static constexpr const char* LABEL = "ROL Accumulator"; };
+template<> struct Opcode<0x2C> { using Type = Op<BIT, ABS, 4>; inline static constexpr const char* LABEL = "BIT Absolute"; };
+template<> struct Opcode<0x2D> { using Type = Op<AND, ABS, 4>; inline static constexpr const char* LABEL = "AND Absolute"; };
+template<> struct Opcode<0x2E> { using Type = Op<ROL, ABS, 6>; inline static constexpr const char* LABEL = "ROL Absolute"; };
+template<> struct Opcode<0x30> { using Type = Op<BMI, REL, 2>; inline static constexpr const char* LABEL = "BMI"; };
+template<> struct Opcode<0x31> { using Type = Op<AND, IDY, 5>; inline static constexpr const char* LABEL = "AND (Indirect),Y"; };
+template<> struct Opcode<0x35> { using Type = Op<AND, ZPX, 3>; inline static constexpr const char* LABEL = "AND Zero Page,X"; };
+template<> struct Opcode<0x36> { using Type = Op<ROL, ZPX, 6>; inline static constexpr const char* LABEL = "ROL Zero Page,X"; };
+template<> struct Opcode<0x38> { using Type = Op<SEC, IMP, 2>; inline static constexpr const char* LABEL = "SEC"; };
+template<> struct Opcode<0x39> { using Type = Op<AND, ABY, 4>; inline static constexpr const char* LABEL = "AND Absolute,Y"; };
+template<> struct Opcode<0x3D> { using Type = Op<AND, ABX, 4>; inline static constexpr const char* LABEL = "AND Absolute,X"; };
+template<> struct Opcode<0x3E> { using Type = Op<ROL, ABX, 7>; inline static constexpr const char* LABEL = "ROL Absolute,X"; };
+template<> struct Opcode<0x40> { using Type = Op<RTI, IMP, 6>; inline static constexpr const char* LABEL = "RTI"; };
+template<> struct Opcode<0x41> { using Type = Op<EOR, IDX, 6>; inline static constexpr const char* LABEL = "EOR (Indirect,X)"; };
+template<> struct Opcode<0x45> { using Type = Op<EOR, ZP0, 3>; inline static constexpr const char* LABEL = "EOR Zero Page"; };
+template<> struct Opcode<0x46> { using Type = Op<LSR, ZP0, 5>; inline static constexpr const char* LABEL = "LSR Zero Page"; };
+template<> struct Opcode<0x48> { using Type = Op<PHA, IMP, 3>; inline static constexpr const char* LABEL = "PHA"; };
+template<> struct Opcode<0x49> { using Type = Op<EOR, IMM, 2>; inline static constexpr const char* LABEL = "EOR Immediate"; };
+template<> struct Opcode<0x4A> { using Type = Op<LSR, ACC, 2>; inline static constexpr const char* LABEL = "LSR Accumulator"; };
+template<> struct Opcode<0x4C> { using Type = Op<JMP, ABS, 3>; inline static constexpr const char* LABEL = "JMP Absolute"; };
+template<> struct Opcode<0x4D> { using Type = Op<EOR, ABS, 4>; inline static constexpr const char* LABEL = "EOR Absolute"; };
+template<> struct Opcode<0x4E> { using Type = Op<LSR, ABS, 6>; inline static constexpr const char* LABEL = "LSR Absolute"; };
+template<> struct Opcode<0x50> { using Type = Op<BVC, REL, 2>; inline static constexpr const char* LABEL = "BVC"; };
+template<> struct Opcode<0x51> { using Type = Op<EOR, IDY, 5>; inline static constexpr const char* LABEL = "EOR (Indirect),Y"; };
+template<> struct Opcode<0x55> { using Type = Op<EOR, ZPX, 4>; inline static constexpr const char* LABEL = "EOR Zero Page,X"; };
+template<> struct Opcode<0x56> { using Type = Op<LSR, ZPX, 6>; inline static constexpr const char* LABEL = "LSR Zero Page,X"; };
+template<> struct Opcode<0x58> { using Type = Op<CLI, IMP, 2>; inline static constexpr const char* LABEL = "CLI"; };
+template<> struct Opcode<0x59> { using Type = Op<EOR, ABY, 4>; inline static constexpr const char* LABEL = "EOR Absolute,Y"; };
+template<> struct Opcode<0x5D> { using Type = Op<EOR, ABX, 4>; inline static constexpr const char* LABEL = "EOR Absolute,X"; };
+template<> struct Opcode<0x5E> { using Type = Op<LSR, ABX, 7>; inline static constexpr const char* LABEL = "LSR Absolute,X"; };
+template<> struct Opcode<0x60> { using Type = Op<RTS, IMP, 6>; inline static constexpr const char* LABEL = "RTS"; };
+template<> struct Opcode<0x61> { using Type = Op<ADC, IDX, 6>; inline static constexpr const char* LABEL = "ADC (Indirect,X)"; };
+template<> struct Opcode<0x65> { using Type = Op<ADC, ZP0, 3>; inline static constexpr const char* LABEL = "ADC Zero Page"; };
+template<> struct Opcode<0x66> { using Type = Op<ROR, ZP0, 5>; inline static constexpr const char* LABEL = "ROR Zero Page"; };
+template<> struct Opcode<0x68> { using Type = Op<PLA, IMP, 4>; inline static constexpr const char* LABEL = "PLA"; };
+template<> struct Opcode<0x69> { using Type = Op<ADC, IMM, 2>; inline static constexpr const char* LABEL = "ADC Immediate"; };
+template<> struct Opcode<0x6A> { using Type = Op<ROR, ACC, 2>; inline static constexpr const char* LABEL = "ROR Accumulator"; };
+template<> struct Opcode<0x6C> { using Type = Op<JMP, IND, 5>; inline static constexpr const char* LABEL = "JMP (Indirect)"; };
+template<> struct Opcode<0x6D> { using Type = Op<ADC, ABS, 4>; inline static constexpr const char* LABEL = "ADC Absolute"; };
+template<> struct Opcode<0x6E> { using Type = Op<ROR, ABS, 6>; inline static constexpr const char* LABEL = "ROR Absolute"; };
+template<> struct Opcode<0x70> { using Type = Op<BVS, REL, 2>; inline static constexpr const char* LABEL = "BVS"; };
+template<> struct Opcode<0x71> { using Type = Op<ADC, IDY, 5>; inline static constexpr const char* LABEL = "ADC (Indirect),Y"; };
+template<> struct Opcode<0x75> { using Type = Op<ADC, ZPX, 4>; inline static constexpr const char* LABEL = "ADC Zero Page,X"; };
+template<> struct Opcode<0x76> { using Type = Op<ROR, ZPX, 6>; inline static constexpr const char* LABEL = "ROR Zero Page,X"; };
+template<> struct Opcode<0x78> { using Type = Op<SEI, IMP, 2>; inline static constexpr const char* LABEL = "SEI"; };
+template<> struct Opcode<0x79> { using Type = Op<ADC, ABY, 4>; inline static constexpr const char* LABEL = "ADC Absolute,Y"; };
+template<> struct Opcode<0x7D> { using Type = Op<ADC, ABX, 4>; inline static constexpr const char* LABEL = "ADC Absolute,X"; };
+template<> struct Opcode<0x7E> { using Type = Op<ROR, ABX, 7>; inline static constexpr const char* LABEL = "ROR Absolute,X"; };
+template<> struct Opcode<0x81> { using Type = Op<STA, IDX, 6>; inline static constexpr const char* LABEL = "STA (Indirect,X)"; };
+template<> struct Opcode<0x84> { using Type = Op<STY, ZP0, 3>; inline static constexpr const char* LABEL = "STY Zero Page"; };
+template<> struct Opcode<0x85> { using Type = Op<STA, ZP0, 3>; inline static constexpr const char* LABEL = "STA Zero Page"; };
+template<> struct Opcode<0x86> { using Type = Op<STX, ZP0, 3>; inline static constexpr const char* LABEL = "STX Zero Page"; };
+template<> struct Opcode<0x88> { using Type = Op<DEY, IMP, 2>; inline static constexpr const char* LABEL = "DEY"; };
+template<> struct Opcode<0x8A> { using Type = Op<TXA, IMP, 2>; inline static constexpr const char* LABEL = "TXA"; };
+template<> struct Opcode<0x8C> { using Type = Op<STY, ABS, 4>; inline static constexpr const char* LABEL = "STY Absolute"; };
+template<> struct Opcode<0x8D> { using Type = Op<STA, ABS, 4>; inline static constexpr const char* LABEL = "STA Absolute"; };
+template<> struct Opcode<0x8E> { using Type = Op<STX, ABS, 4>; inline static constexpr const char* LABEL = "STX Absolute"; };
+template<> struct Opcode<0x90> { using Type = Op<BCC, REL, 2>; inline static constexpr const char* LABEL = "BCC"; };
+template<> struct Opcode<0x91> { using Type = Op<STA, IDY, 6>; inline static constexpr const char* LABEL = "STA (Indirect),Y"; };
+template<> struct Opcode<0x94> { using Type = Op<STY, ZPX, 4>; inline static constexpr const char* LABEL = "STY Zero Page,X"; };
+template<> struct Opcode<0x95> { using Type = Op<STA, ZPX, 4>; inline static constexpr const char* LABEL = "STA Zero Page,X"; };
+template<> struct Opcode<0x96> { using Type = Op<STX, ZPY, 4>; inline static constexpr const char* LABEL = "STX Zero Page,Y"; };
+template<> struct Opcode<0x98> { using Type = Op<TYA, IMP, 2>; inline static constexpr const char* LABEL = "TYA"; };
+template<> struct Opcode<0x99> { using Type = Op<STA, ABY, 5>; inline static constexpr const char* LABEL = "STA Absolute,Y"; };
+template<> struct Opcode<0x9A> { using Type = Op<TXS, IMP, 2>; inline static constexpr const char* LABEL = "TXS"; };
+template<> struct Opcode<0x9D> { using Type = Op<STA, ABX, 5>; inline static constexpr const char* LABEL = "STA Absolute,X"; };
+template<> struct Opcode<0xA0> { using Type = Op<LDY, IMM, 2>; inline static constexpr const char* LABEL = "LDY Immediate"; };
+template<> struct Opcode<0xA1> { using Type = Op<LDA, IDX, 6>; inline static constexpr const char* LABEL = "LDA (Indirect,X)"; };
+template<> struct Opcode<0xA2> { using Type = Op<LDX, IMM, 2>; inline static constexpr const char* LABEL = "LDX Immediate"; };
+template<> struct Opcode<0xA4> { using Type = Op<LDY, ZP0, 3>; inline static constexpr const char* LABEL = "LDY Zero Page"; };
+template<> struct Opcode<0xA5> { using Type = Op<LDA, ZP0, 3>; inline static constexpr const char* LABEL = "LDA Zero Page"; };
+template<> struct Opcode<0xA6> { using Type = Op<LDX, ZP0, 3>; inline static constexpr const char* LABEL = "LDX Zero Page"; };
+template<> struct Opcode<0xA8> { using Type = Op<TAY, IMP, 2>; inline static constexpr const char* LABEL = "TAY"; };
+template<> struct Opcode<0xA9> { using Type = Op<LDA, IMM, 2>; inline static constexpr const char* LABEL = "LDA Immediate"; };
+template<> struct Opcode<0xAA> { using Type = Op<TAX, IMP, 2>; inline static constexpr const char* LABEL = "TAX"; };
+template<> struct Opcode<0xAC> { using Type = Op<LDY, ABS, 4>; inline static constexpr const char* LABEL = "LDY Absolute"; };
+template<> struct Opcode<0xAD> { using Type = Op<LDA, ABS, 4>; inline static constexpr const char* LABEL = "LDA Absolute"; };
+template<> struct Opcode<0xAE> { using Type = Op<LDX, ABS, 4>; inline static constexpr const char* LABEL = "LDX Absolute"; };
+template<> struct Opcode<0xB0> { using Type = Op<BCS, REL, 2>; inline static constexpr const char* LABEL = "BCS"; };
+template<> struct Opcode<0xB1> { using Type = Op<LDA, IDY, 5>; inline static constexpr const char* LABEL = "LDA (Indirect),Y"; };
+template<> struct Opcode<0xB4> { using Type = Op<LDY, ZPX, 4>; inline static constexpr const char* LABEL = "LDY Zero Page,X"; };
+template<> struct Opcode<0xB5> { using Type = Op<LDA, ZPX, 4>; inline static constexpr const char* LABEL = "LDA Zero Page,X"; };
+template<> struct Opcode<0xB6> { using Type = Op<LDX, ZPY, 4>; inline static constexpr const char* LABEL = "LDX Zero Page,Y"; };
+template<> struct Opcode<0xB8> { using Type = Op<CLV, IMP, 2>; inline static constexpr const char* LABEL = "CLV"; };
+template<> struct Opcode<0xB9> { using Type = Op<LDA, ABY, 4>; inline static constexpr const char* LABEL = "LDA Absolute,Y"; };
+template<> struct Opcode<0xBA> { using Type = Op<TSX, IMP, 2>; inline static constexpr const char* LABEL = "TSX"; };
+template<> struct Opcode<0xBC> { using Type = Op<LDY, ABX, 4>; inline static constexpr const char* LABEL = "LDY Absolute,X"; };
+template<> struct Opcode<0xBD> { using Type = Op<LDA, ABX, 4>; inline static constexpr const char* LABEL = "LDA Absolute,X"; };
+template<> struct Opcode<0xBE> { using Type = Op<LDX, ABY, 4>; inline static constexpr const char* LABEL = "LDX Absolute,Y"; };
+template<> struct Opcode<0xC0> { using Type = Op<CPY, IMM, 2>; inline static constexpr const char* LABEL = "CPY Immediate"; };
+template<> struct Opcode<0xC1> { using Type = Op<CMP, IDX, 6>; inline static constexpr const char* LABEL = "CMP (Indirect,X)"; };
+template<> struct Opcode<0xC4> { using Type = Op<CPY, ZP0, 3>; inline static constexpr const char* LABEL = "CPY Zero Page"; };
+template<> struct Opcode<0xC5> { using Type = Op<CMP, ZP0, 3>; inline static constexpr const char* LABEL = "CMP Zero Page"; };
+template<> struct Opcode<0xC6> { using Type = Op<DEC, ZP0, 5>; inline static constexpr const char* LABEL = "DEC Zero Page"; };
+template<> struct Opcode<0xC8> { using Type = Op<INY, IMP, 2>; inline static constexpr const char* LABEL = "INY"; };
+template<> struct Opcode<0xC9> { using Type = Op<CMP, IMM, 2>; inline static constexpr const char* LABEL = "CMP Immediate"; };
+template<> struct Opcode<0xCA> { using Type = Op<DEX, IMP, 2>; inline static constexpr const char* LABEL = "DEX"; };
+template<> struct Opcode<0xCC> { using Type = Op<CPY, ABS, 4>; inline static constexpr const char* LABEL = "CPY Absolute"; };
+template<> struct Opcode<0xCD> { using Type = Op<CMP, ABS, 4>; inline static constexpr const char* LABEL = "CMP Absolute"; };
+template<> struct Opcode<0xCE> { using Type = Op<DEC, ABS, 6>; inline static constexpr const char* LABEL = "DEC Absolute"; };
+template<> struct Opcode<0xD0> { using Type = Op<BNE, REL, 2>; inline static constexpr const char* LABEL = "BNE"; };
+template<> struct Opcode<0xD1> { using Type = Op<CMP, IDY, 5>; inline static constexpr const char* LABEL = "CMP (Indirect),Y"; };
+template<> struct Opcode<0xD5> { using Type = Op<CMP, ZPX, 4>; inline static constexpr const char* LABEL = "CMP Zero Page X"; };
+template<> struct Opcode<0xD6> { using Type = Op<DEC, ZPX, 6>; inline static constexpr const char* LABEL = "DEC Zero Page,X"; };
+template<> struct Opcode<0xD8> { using Type = Op<CLD, IMP, 2>; inline static constexpr const char* LABEL = "CLD"; };
+template<> struct Opcode<0xD9> { using Type = Op<CMP, ABY, 4>; inline static constexpr const char* LABEL = "CMP Absolute,Y"; };
+template<> struct Opcode<0xDD> { using Type = Op<CMP, ABX, 4>; inline static constexpr const char* LABEL = "CMP Absolute,X"; };
+template<> struct Opcode<0xDE> { using Type = Op<DEC, ABX, 7>; inline static constexpr const char* LABEL = "DEC Absolute,X"; };
+template<> struct Opcode<0xE0> { using Type = Op<CPX, IMM, 2>; inline static constexpr const char* LABEL = "CPX Immediate"; };
+template<> struct Opcode<0xE1> { using Type = Op<SBC, IDX, 6>; inline static constexpr const char* LABEL = "SBC (Indirect,X)"; };
+template<> struct Opcode<0xE4> { using Type = Op<CPX, ZP0, 3>; inline static constexpr const char* LABEL = "CPX Zero Page"; };
+template<> struct Opcode<0xE5> { using Type = Op<SBC, ZP0, 3>; inline static constexpr const char* LABEL = "SBC Zero Page"; };
+template<> struct Opcode<0xE6> { using Type = Op<INC, ZP0, 5>; inline static constexpr const char* LABEL = "INC Zero Page"; };
+template<> struct Opcode<0xE8> { using Type = Op<INX, IMP, 2>; inline static constexpr const char* LABEL = "INX"; };
+template<> struct Opcode<0xE9> { using Type = Op<SBC, IMM, 2>; inline static constexpr const char* LABEL = "SBC Immediate"; };
+template<> struct Opcode<0xEA> { using Type = Op<NOP, IMP, 2>; inline static constexpr const char* LABEL = "NOP"; };
+template<> struct Opcode<0xEC> { using Type = Op<CPX, ABS, 4>; inline static constexpr const char* LABEL = "CPX Absolute"; };
+template<> struct Opcode<0xED> { using Type = Op<SBC, ABS, 4>; inline static constexpr const char* LABEL = "SBC Absolute"; };
+template<> struct Opcode<0xEE> { using Type = Op<INC, ABS, 6>; inline static constexpr const char* LABEL = "INC Absolute"; };
+template<> struct Opcode<0xF0> { using Type = Op<BEQ, REL, 2>; inline static constexpr const char* LABEL = "BEQ"; };
+template<> struct Opcode<0xF1> { using Type = Op<SBC, IDY, 5>; inline static constexpr const char* LABEL = "SBC (Indirect),Y"; };
+template<> struct Opcode<0xF5> { using Type = Op<SBC, ZPX, 4>; inline static constexpr const char* LABEL = "SBC Zero Page,X"; };
+template<> struct Opcode<0xF6> { using Type = Op<INC, ZPX, 6>; inline static constexpr const char* LABEL = "INC Zero Page,X"; };
+template<> struct Opcode<0xF8> { using Type = Op<SED, IMP, 2>; inline static constexpr const char* LABEL = "SED"; };
+template<> struct Opcode<0xF9> { using Type = Op<SBC, ABY, 4>; inline static constexpr const char* LABEL = "SBC Absolute,Y"; };
+template<> struct Opcode<0xFD> { using Type = Op<SBC, ABX, 4>; inline static constexpr const char* LABEL = "SBC Absolute,X"; };
+template<> struct Opcode<0xFE> { using Type = Op<INC, ABX, 7>; inline static constexpr const char* LABEL = "INC Absolute,X"; };
+
+/**
+* Disassembly information
+* about a single opcode.
+* 
+* @see OpcodeLUT
+*/
+struct OpcodeInfo {
+    const char* label;  //mnemonic and addressing mode of the instruction
+    uint8_t length;     //length of the instruction in bytes, including the opcode
+    uint8_t cycles;     //base cost of the instruction in CPU cycles
+    bool controlFlow;   //tells if the instruction can change the flow of the program
+};
+
+/**
+* Builds an array of instructions
+* where each instruction is in a
+* position corresponding to its opcode.
+* 
+* @return array of instructions
+*/
+template<size_t... Codes>
+constexpr std::array<Instruction, sizeof...(Codes)> makeInstructionTable(std::index_sequence<Codes...>) {
+    return { &Opcode<Codes>::Type::execute... };
+}
+
+/**
+* Builds an array of instructions
+* taking already fetched operands,
+* where each instruction is in a
+* position corresponding to its opcode.
+* 
+* @return array of instructions
+*/
+template<size_t... Codes>
+constexpr std::array<DecodedInstruction, sizeof...(Codes)> makeDecodedInstructionTable(std::index_sequence<Codes...>) {
+    return { &Opcode<Codes>::Type::executeDecoded... };
+}
+
+/**
+* Builds an array of disassembly
+* information where each entry is
+* in a position corresponding to
+* its opcode.
+* 
+* @return array of opcode information
+*/
+template<size_t... Codes>
+constexpr std::array<OpcodeInfo, sizeof...(Codes)> makeOpcodeInfoTable(std::index_sequence<Codes...>) {
+    return { OpcodeInfo{ 
+        Opcode<Codes>::LABEL, 
+        Opcode<Codes>::Type::LENGTH, 
+        Opcode<Codes>::Type::CYCLES, 
+        Opcode<Codes>::Type::CONTROL_FLOW 
+    }... };
+}
+
 /**
 * Lookup table for all
 * available opcodes and
 * their corresponding 
 * operations and addressing
 * modes supported by the
-* MOS6502 CPU.
+* MOS6502 CPU. Both tables are
+* generated at compile time from
+* the Opcode specializations, so
+* there is nothing to construct at
+* startup. The disassembly information
+* is kept apart from the instructions, 
+* so the dispatch table stays small.
 * 
 * @see MOS6502
-* @see Instruction
+* @see Opcode
 * @see Operation
 * @see AddressingMode
 */
 class OpcodeLUT {
+public:
 
-    friend class MOS6502;
     using Byte = uint8_t;
 
     /**
-    * Fetches the Instruction object
+    * Fetches the instruction
     * based on a given opcode.
     * 
     * @param code code of the operation
     * 
-    * @return Instruction object 
-    *   corresponding to the given opcode
+    * @return instruction corresponding
+    *   to the given opcode
     */
-    Instruction& operator[](const Byte& code) { return mOpcodes[code]; }
+    static constexpr Instruction getInstruction(const Byte& code) { return sInstructions[code]; }
 
     /**
-    * An array of Instruction objects
-    * where each operation is in a position
+    * Fetches the instruction taking
+    * an already fetched operand based
+    * on a given opcode.
+    * 
+    * @param code code of the operation
+    * 
+    * @return instruction corresponding
+    *   to the given opcode
+    */
+    static constexpr DecodedInstruction getDecodedInstruction(const Byte& code) { return sDecodedInstructions[code]; }
+
+    /**
+    * Fetches the disassembly
+    * information about a given
+    * opcode.
+    * 
+    * @param code code of the operation
+    * 
+    * @return information about
+    *   the given opcode
+    */
+    static constexpr const OpcodeInfo& getInfo(const Byte& code) { return sInfo[code]; }
+
+private:
+
+    /**
+    * An array of instructions where
+    * each instruction is in a position
     * corresponding to its opcode.
     */
-    Instruction mOpcodes[256] = {
-        Instruction("BRK", BRK::getInstance(), IMP::getInstance(), 7),
-        Instruction("ORA indirect X", ORA::getInstance(), IDX::getInstance(), 6),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("ORA Zero Page", ORA::getInstance(), ZP0::getInstance(), 3),
-        Instruction("ASL Zero Page", ASL::getInstance(), ZP0::getInstance(), 5),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("PHP", PHP::getInstance(), IMP::getInstance(), 3),
-        Instruction("ORA Immediate", ORA::getInstance(), IMM::getInstance(), 2),
-        Instruction("ASL Accumulator", ASL::getInstance(), ACC::getInstance(), 2),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("ORA Absolute", ORA::getInstance(), ABS::getInstance(), 4),
-        Instruction("ASL Absolute", ASL::getInstance(), ABS::getInstance(), 6),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("BPL", BPL::getInstance(), REL::getInstance(), 2),
-        Instruction("ORA (Indirect),Y", ORA::getInstance(), IDY::getInstance(), 5),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("ORA Zero Page,X", ORA::getInstance(), ZPX::getInstance(), 4),
-        Instruction("ASL Zero Page,X", ASL::getInstance(), ZPX::getInstance(), 6),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("CLC", CLC::getInstance(), IMP::getInstance(), 2),
-        Instruction("ORA Absolute,Y", ORA::getInstance(), ABY::getInstance(), 4),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("ORA Absolute,X", ORA::getInstance(), ABX::getInstance(), 4),
-        Instruction("ASL Absolute,X", ASL::getInstance(), ABX::getInstance(), 7),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("JSR Absolute", JSR::getInstance(), ABS::getInstance(), 6),
-        Instruction("AND (Indirect,X)", AND::getInstance(), IDX::getInstance(), 6),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("BIT Zero Page", BIT::getInstance(), ZP0::getInstance(), 3),
-        Instruction("AND Zero Page", AND::getInstance(), ZP0::getInstance(), 3),
-        Instruction("ROL Zero Page", ROL::getInstance(), ZP0::getInstance(), 5),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("PLP", PLP::getInstance(), IMP::getInstance(), 4),
-        Instruction("AND Immediate", AND::getInstance(), IMM::getInstance(), 2),
-        Instruction("ROL Accumulator", ROL::getInstance(), ACC::getInstance(), 2),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("BIT Absolute", BIT::getInstance(), ABS::getInstance(), 4),
-        Instruction("AND Absolute", AND::getInstance(), ABS::getInstance(), 4),
-        Instruction("ROL Absolute", ROL::getInstance(), ABS::getInstance(), 6),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("BMI", BMI::getInstance(), REL::getInstance(), 2),
-        Instruction("AND (Indirect),Y", AND::getInstance(), IDY::getInstance(), 5),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("AND Zero Page,X", AND::getInstance(), ZPX::getInstance(), 3),
-        Instruction("ROL Zero Page,X", ROL::getInstance(), ZPX::getInstance(), 6),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("SEC", SEC::getInstance(), IMP::getInstance(), 2),
-        Instruction("AND Absolute,Y", AND::getInstance(), ABY::getInstance(), 4),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("AND Absolute,X", AND::getInstance(), ABX::getInstance(), 4),
-        Instruction("ROL Absolute,X", ROL::getInstance(), ABX::getInstance(), 7),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("RTI", RTI::getInstance(), IMP::getInstance(), 6),
-        Instruction("EOR (Indirect,X)", EOR::getInstance(), IDX::getInstance(), 6),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("EOR Zero Page", EOR::getInstance(), ZP0::getInstance(), 3),
-        Instruction("LSR Zero Page", LSR::getInstance(), ZP0::getInstance(), 5),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("PHA", PHA::getInstance(), IMP::getInstance(), 3),
-        Instruction("EOR Immediate", EOR::getInstance(), IMM::getInstance(), 2),
-        Instruction("LSR Accumulator", LSR::getInstance(), ACC::getInstance(), 2),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("JMP Absolute", JMP::getInstance(), ABS::getInstance(), 3),
-        Instruction("EOR Absolute", EOR::getInstance(), ABS::getInstance(), 4),
-        Instruction("LSR Absolute", LSR::getInstance(), ABS::getInstance(), 6),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("BVC", BVC::getInstance(), REL::getInstance(), 2),
-        Instruction("EOR (Indirect),Y", EOR::getInstance(), IDY::getInstance(), 5),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("EOR Zero Page,X", EOR::getInstance(), ZPX::getInstance(), 4),
-        Instruction("LSR Zero Page,X", LSR::getInstance(), ZPX::getInstance(), 6),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("CLI", CLI::getInstance(), IMP::getInstance(), 2),
-        Instruction("EOR Absolute,Y", EOR::getInstance(), ABY::getInstance(), 4),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("EOR Absolute,X", EOR::getInstance(), ABX::getInstance(), 4),
-        Instruction("LSR Absolute,X", LSR::getInstance(), ABX::getInstance(), 7),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("RTS", RTS::getInstance(), IMP::getInstance(), 6),
-        Instruction("ADC (Indirect,X)", ADC::getInstance(), IDX::getInstance(), 6),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("ADC Zero Page", ADC::getInstance(), ZP0::getInstance(), 3),
-        Instruction("ROR Zero Page", ROR::getInstance(), ZP0::getInstance(), 5),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("PLA", PLA::getInstance(), IMP::getInstance(), 4),
-        Instruction("ADC Immediate", ADC::getInstance(), IMM::getInstance(), 2),
-        Instruction("ROR Accumulator", ROR::getInstance(), ACC::getInstance(), 2),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("JMP (Indirect)", JMP::getInstance(), IND::getInstance(), 5),
-        Instruction("ADC Absolute", ADC::getInstance(), ABS::getInstance(), 4),
-        Instruction("ROR Absolute", ROR::getInstance(), ABS::getInstance(), 6),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("BVS", BVS::getInstance(), REL::getInstance(), 2),
-        Instruction("ADC (Indirect),Y", ADC::getInstance(), IDY::getInstance(), 5),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("ADC Zero Page,X", ADC::getInstance(), ZPX::getInstance(), 4),
-        Instruction("ROR Zero Page,X", ROR::getInstance(), ZPX::getInstance(), 6),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("SEI", SEI::getInstance(), IMP::getInstance(), 2),
-        Instruction("ADC Absolute,Y", ADC::getInstance(), ABY::getInstance(), 4),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("ADC Absolute,X", ADC::getInstance(), ABX::getInstance(), 4),
-        Instruction("ROR Absolute,X", ROR::getInstance(), ABX::getInstance(), 7),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("STA (Indirect,X)", STA::getInstance(), IDX::getInstance(), 6),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("STY Zero Page", STY::getInstance(), ZP0::getInstance(), 3),
-        Instruction("STA Zero Page", STA::getInstance(), ZP0::getInstance(), 3),
-        Instruction("STX Zero Page", STX::getInstance(), ZP0::getInstance(), 3),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("DEY", DEY::getInstance(), IMP::getInstance(), 2),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("TXA", TXA::getInstance(), IMP::getInstance(), 2),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("STY Absolute", STY::getInstance(), ABS::getInstance(), 4),
-        Instruction("STA Absolute", STA::getInstance(), ABS::getInstance(), 4),
-        Instruction("STX Absolute", STX::getInstance(), ABS::getInstance(), 4),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("BCC", BCC::getInstance(), REL::getInstance(), 2),
-        Instruction("STA (Indirect),Y", STA::getInstance(), IDY::getInstance(), 6),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("STY Zero Page,X", STY::getInstance(), ZPX::getInstance(), 4),
-        Instruction("STA Zero Page,X", STA::getInstance(), ZPX::getInstance(), 4),
-        Instruction("STX Zero Page,Y", STX::getInstance(), ZPY::getInstance(), 4),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("TYA", TYA::getInstance(), IMP::getInstance(), 2),
-        Instruction("STA Absolute,Y", STA::getInstance(), ABY::getInstance(), 5),
-        Instruction("TXS", TXS::getInstance(), IMP::getInstance(), 2),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("STA Absolute,X", STA::getInstance(), ABX::getInstance(), 5),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0), 
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("LDY Immediate", LDY::getInstance(), IMM::getInstance(), 2),
-        Instruction("LDA (Indirect,X)", LDA::getInstance(), IDX::getInstance(), 6),
-        Instruction("LDX Immediate", LDX::getInstance(), IMM::getInstance(), 2),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("LDY Zero Page", LDY::getInstance(), ZP0::getInstance(), 3),
-        Instruction("LDA Zero Page", LDA::getInstance(), ZP0::getInstance(), 3),
-        Instruction("LDX Zero Page", LDX::getInstance(), ZP0::getInstance(), 3),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("TAY", TAY::getInstance(), IMP::getInstance(), 2),
-        Instruction("LDA Immediate", LDA::getInstance(), IMM::getInstance(), 2),
-        Instruction("TAX", TAX::getInstance(), IMP::getInstance(), 2),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("LDY Absolute", LDY::getInstance(), ABS::getInstance(), 4),
-        Instruction("LDA Absolute", LDA::getInstance(), ABS::getInstance(), 4),
-        Instruction("LDX Absolute", LDX::getInstance(), ABS::getInstance(), 4),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("BCS", BCS::getInstance(), REL::getInstance(), 2),
-        Instruction("LDA (Indirect),Y", LDA::getInstance(), IDY::getInstance(), 5),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("LDY Zero Page,X", LDY::getInstance(), ZPX::getInstance(), 4),
-        Instruction("LDA Zero Page,X", LDA::getInstance(), ZPX::getInstance(), 4),
-        Instruction("LDX Zero Page,Y", LDX::getInstance(), ZPY::getInstance(), 4),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("CLV", CLV::getInstance(), IMP::getInstance(), 2),
-        Instruction("LDA Absolute,Y", LDA::getInstance(), ABY::getInstance(), 4),
-        Instruction("TSX", TSX::getInstance(), IMP::getInstance(), 2),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("LDY Absolute,X", LDY::getInstance(), ABX::getInstance(), 4),
-        Instruction("LDA Absolute,X", LDA::getInstance(), ABX::getInstance(), 4),
-        Instruction("LDX Absolute,Y", LDX::getInstance(), ABY::getInstance(), 4),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("CPY Immediate", CPY::getInstance(), IMM::getInstance(), 2),
-        Instruction("CMP (Indirect,X)", CMP::getInstance(), IDX::getInstance(), 6),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("CPY Zero Page", CPY::getInstance(), ZP0::getInstance(), 3),
-        Instruction("CMP Zero Page", CMP::getInstance(), ZP0::getInstance(), 3),
-        Instruction("DEC Zero Page", DEC::getInstance(), ZP0::getInstance(), 5),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("INY", INY::getInstance(), IMP::getInstance(), 2),
-        Instruction("CMP Immediate", CMP::getInstance(), IMM::getInstance(), 2),
-        Instruction("DEX", DEX::getInstance(), IMP::getInstance(), 2),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("CPY Absolute", CPY::getInstance(), ABS::getInstance(), 4),
-        Instruction("CMP Absolute", CMP::getInstance(), ABS::getInstance(), 4),
-        Instruction("DEC Absolute", DEC::getInstance(), ABS::getInstance(), 6),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("BNE", BNE::getInstance(), REL::getInstance(), 2),
-        Instruction("CMP (Indirect),Y", CMP::getInstance(), IDY::getInstance(), 5),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0), 
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0), 
-        Instruction("CMP Zero Page X", CMP::getInstance(), ZPX::getInstance(), 4),
-        Instruction("DEC Zero Page,X", DEC::getInstance(), ZPX::getInstance(), 6),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("CLD", CLD::getInstance(), IMP::getInstance(), 2),
-        Instruction("CMP Absolute,Y", CMP::getInstance(), ABY::getInstance(), 4),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0), 
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0), 
-        Instruction("CMP Absolute,X", CMP::getInstance(), ABX::getInstance(), 4),
-        Instruction("DEC Absolute,X", DEC::getInstance(), ABX::getInstance(), 7),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("CPX Immediate", CPX::getInstance(), IMM::getInstance(), 2),
-        Instruction("SBC (Indirect,X)", SBC::getInstance(), IDX::getInstance(), 6),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0), 
-        Instruction("CPX Zero Page", CPX::getInstance(), ZP0::getInstance(), 3),
-        Instruction("SBC Zero Page", SBC::getInstance(), ZP0::getInstance(), 3),
-        Instruction("INC Zero Page", INC::getInstance(), ZP0::getInstance(), 5),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("INX", INX::getInstance(), IMP::getInstance(), 2),
-        Instruction("SBC Immediate", SBC::getInstance(), IMM::getInstance(), 2),
-        Instruction("NOP", NOP::getInstance(), IMP::getInstance(), 2),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0), 
-        Instruction("CPX Absolute", CPX::getInstance(), ABS::getInstance(), 4),
-        Instruction("SBC Absolute", SBC::getInstance(), ABS::getInstance(), 4),
-        Instruction("INC Absolute", INC::getInstance(), ABS::getInstance(), 6),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("BEQ", BEQ::getInstance(), REL::getInstance(), 2),
-        Instruction("SBC (Indirect),Y", SBC::getInstance(), IDY::getInstance(), 5),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0), 
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0), 
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0), 
-        Instruction("SBC Zero Page,X", SBC::getInstance(), ZPX::getInstance(), 4),
-        Instruction("INC Zero Page,X", INC::getInstance(), ZPX::getInstance(), 6),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("SED", SED::getInstance(), IMP::getInstance(), 2),
-        Instruction("SBC Absolute,Y", SBC::getInstance(), ABY::getInstance(), 4),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0), 
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0), 
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0),
-        Instruction("SBC Absolute,X", SBC::getInstance(), ABX::getInstance(), 4),
-        Instruction("INC Absolute,X", INC::getInstance(), ABX::getInstance(), 7),
-        Instruction("Undefined", UndefinedOperation::getInstance(), UndefinedAddressingMode::getInstance(), 0)
-    };
+    inline static constexpr std::array<Instruction, 256> sInstructions = makeInstructionTable(std::make_index_sequence<256>());
+
+    /**
+    * An array of instructions taking
+    * already fetched operands, in the
+    * same order as sInstructions.
+    */
+    inline static constexpr std::array<DecodedInstruction, 256> sDecodedInstructions = makeDecodedInstructionTable(std::make_index_sequence<256>());
+
+    /**
+    * An array of disassembly 
+    * information where each entry
+    * is in a position corresponding
+    * to its opcode.
+    */
+    inline static constexpr std::array<OpcodeInfo, 256> sInfo = makeOpcodeInfoTable(std::make_index_sequence<256>());
 
 };
 
@@ -3,16 +3,23 @@
 
 #include <cstdint>
 
-#include "NES/MOS6502/AddressingMode.h"
-
-class MOS6502;
-enum ProcessorFlag;
+#include "NES/MOS6502/MOS6502.h"
 
 /**
 * Base class for representing
-* MOS6502 operations.
+* MOS6502 operations. Operations
+* hold no state, so every one
+* of them is a class with a
+* static execute(MOS6502&)
+* method defined in this header,
+* which lets the compiler inline
+* it into the instructions using it.
+* Operations that can jump somewhere
+* else than the next instruction are
+* marked with CONTROL_FLOW.
 * 
 * @see MOS6502
+* @see Op
 */
 class Operation {
 public:
@@ -20,23 +27,11 @@ public:
 	using Byte = uint8_t;
 	using Word = uint16_t;
 
-	void operator=(const Operation& other) = delete;
-
-	/**
-	* Executes the operation.
-	* 
-	* @param cpu CPU that
-	*	executes the operation
-	*/
-	virtual void execute(MOS6502& cpu) { /*DO_NOTHING*/ }
+	/** Tells if the operation can change the flow of the program */
+	inline static constexpr bool CONTROL_FLOW = false;
 
 protected:
 
-	/**
-	* Default class constructor.
-	*/
-	Operation(void) {}
-
 	/**
 	* Writes a byte of data
 	* to a given address.
@@ -48,7 +43,7 @@ protected:
 	* @param address address to write
 	*	data to
 	*/
-	void writeMemory(MOS6502& cpu, const Byte& data, const Word& address);
+	static void writeMemory(MOS6502& cpu, const Byte& data, const Word& address) { cpu.writeMemory(data, address); }
 
 	/**
 	* Pushes a value onto
@@ -59,7 +54,7 @@ protected:
 	* @param data data to be pushed
 	*	on the stack
 	*/
-	void pushStack(MOS6502& cpu, const Byte& data);
+	static void pushStack(MOS6502& cpu, const Byte& data) { cpu.pushStack(data); }
 
 	/**
 	* Adds cycles to the CPU's
@@ -70,7 +65,7 @@ protected:
 	* @param cycles amount of cycles
 	*	to add to the CPU clock counter
 	*/
-	void addCycles(MOS6502& cpu, const Byte& cycles);
+	static void addCycles(MOS6502& cpu, const Byte& cycles) { cpu.addCycles(cycles); }
 
 	/**
 	* Sets the CPU's X register
@@ -81,7 +76,7 @@ protected:
 	* @param status new X register
 	*	value
 	*/
-	void setCpuX(MOS6502& cpu, const Byte& value);
+	static void setCpuX(MOS6502& cpu, const Byte& value) { cpu.setX(value); }
 
 	/**
 	* Sets the CPU's Y register
@@ -92,7 +87,7 @@ protected:
 	* @param status new Y register
 	*	value
 	*/
-	void setCpuY(MOS6502& cpu, const Byte& value);
+	static void setCpuY(MOS6502& cpu, const Byte& value) { cpu.setY(value); }
 
 	/**
 	* Sets the CPU's accumulator
@@ -103,7 +98,7 @@ protected:
 	* @param status new accumulator
 	*	register value
 	*/
-	void setCpuAccumulator(MOS6502& cpu, const Byte& value);
+	static void setCpuAccumulator(MOS6502& cpu, const Byte& value) { cpu.setAccumulator(value); }
 
 	/**
 	* Sets the CPU's status
@@ -114,7 +109,7 @@ protected:
 	* @param status new status
 	*	value
 	*/
-	void setCpuStatus(MOS6502& cpu, const Byte& status);
+	static void setCpuStatus(MOS6502& cpu, const Byte& status) { cpu.setPorcessorStatus(status); }
 
 	/**
 	* Sets the CPU's stack
@@ -125,7 +120,7 @@ protected:
 	* @param value new stack pointer
 	*	value
 	*/
-	void setCpuStackPointer(MOS6502& cpu, const Byte& value);
+	static void setCpuStackPointer(MOS6502& cpu, const Byte& value) { cpu.setStackPointer(value); }
 
 	/**
 	* Sets the CPU's program
@@ -136,7 +131,7 @@ protected:
 	* @param value new program counter
 	*	value
 	*/
-	void setCpuProgramCounter(MOS6502& cpu, const Word& value);
+	static void setCpuProgramCounter(MOS6502& cpu, const Word& value) { cpu.setProgramCounter(value); }
 
 	/**
 	* Sets or clears a specific
@@ -148,7 +143,7 @@ protected:
 	*	or cleared
 	* @state new state of the flag
 	*/
-	void setCpuFlag(MOS6502& cpu, const ProcessorFlag& flag, const bool& state);
+	static void setCpuFlag(MOS6502& cpu, const ProcessorFlag& flag, const bool& state) { cpu.setFlag(flag, state); }
 
 	/**
 	* Fetches a byte of data from
@@ -160,7 +155,7 @@ protected:
 	* 
 	* @return fetched data
 	*/
-	Byte fetchByte(MOS6502& cpu); 
+	static Byte fetchByte(MOS6502& cpu) { return cpu.fetchByte(); }
 
 	/**
 	* Fetches a byte of data from
@@ -171,7 +166,7 @@ protected:
 	* 
 	* @return fetched data
 	*/
-	Byte fetchByte(MOS6502& cpu, const Word& address);
+	static Byte fetchByte(MOS6502& cpu, const Word& address) { return cpu.fetchByte(address); }
 
 	/**
 	* Fetches a byte of data
@@ -182,735 +177,665 @@ protected:
 	* 
 	* @return fetched data
 	*/
-	Byte fetchStack(MOS6502& cpu);
+	static Byte fetchStack(MOS6502& cpu) { return cpu.fetchStack(); }
 
+	/**
+	* Returns the information
+	* if a memory page was crossed
+	* while fetching the address
+	* of the operation's argument.
+	* 
+	* @param cpu CPU that executes
+	*	the operation
+	* 
+	* @return flag indicating
+	*	if a memory page was
+	*	crossed
+	*/
+	static bool pageCrossed(const MOS6502& cpu) { return cpu.mPageCrossed; }
 };
 
 
 class UndefinedOperation : public Operation {
 public:
-
-	void operator=(const UndefinedOperation& other) = delete;
-	static UndefinedOperation* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	UndefinedOperation(void) {}
-	static UndefinedOperation* sInstance;
+	static void execute(MOS6502& cpu) {
+		/* DO NOTHING */
+	}
 };
 
 /* LOAD/STORE OPERATIONS */
 
-
 class LDA : public Operation {
 public:
-
-	void operator=(const LDA& other) = delete;
-	static LDA* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	LDA(void) {}
-	static LDA* sInstance;
+	static void execute(MOS6502& cpu) {
+		Byte data = cpu.getFetched();
+		setCpuFlag(cpu, ProcessorFlag::FLAG_ZERO, data == 0);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_NEGATIVE, data & ProcessorFlag::FLAG_NEGATIVE);
+		setCpuAccumulator(cpu, data);
+		if (pageCrossed(cpu)) { addCycles(cpu, 1); }
+	}
 };
 
 class LDX : public Operation {
 public:
-
-	void operator=(const LDX& other) = delete;
-	static LDX* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	LDX(void) {}
-	static LDX* sInstance;
+	static void execute(MOS6502& cpu) {
+		Byte data = cpu.getFetched();
+		setCpuFlag(cpu, ProcessorFlag::FLAG_ZERO, data == 0);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_NEGATIVE, data & ProcessorFlag::FLAG_NEGATIVE);
+		setCpuX(cpu, data);
+		if (pageCrossed(cpu)) { addCycles(cpu, 1); }
+	}
 };
 
 class LDY : public Operation {
 public:
-
-	void operator=(const LDY& other) = delete;
-	static LDY* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	LDY(void) {}
-	static LDY* sInstance;
+	static void execute(MOS6502& cpu) {
+		Byte data = cpu.getFetched();
+		setCpuFlag(cpu, ProcessorFlag::FLAG_ZERO, data == 0);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_NEGATIVE, data & ProcessorFlag::FLAG_NEGATIVE);
+		setCpuY(cpu, data);
+		if (pageCrossed(cpu)) { addCycles(cpu, 1); }
+	}
 };
 
 class STA : public Operation {
 public:
-
-	void operator=(const STA& other) = delete;
-	static STA* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	STA(void) {}
-	static STA* sInstance;
+	static void execute(MOS6502& cpu) {
+		writeMemory(cpu, cpu.getAccumulator(), cpu.getFetchedAddress());
+	}
 };
 
 class STX : public Operation {
 public:
-
-	void operator=(const STX& other) = delete;
-	static STX* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	STX(void) {}
-	static STX* sInstance;
+	static void execute(MOS6502& cpu) {
+		writeMemory(cpu, cpu.getX(), cpu.getFetchedAddress());
+	}
 };
 
 class STY : public Operation {
 public:
-
-	void operator=(const STY& other) = delete;
-	static STY* getInstance(void);
-	void execute(MOS6502& cpu); 
-
-private:
-	STY(void) {}
-	static STY* sInstance;
+	static void execute(MOS6502& cpu) {
+		writeMemory(cpu, cpu.getY(), cpu.getFetchedAddress());
+	}
 };
 
-
-/* REGISTER TRANSFERS*/
-
+/* REGISTER TRANSFERS */
 
 class TAX : public Operation {
 public:
-
-	void operator=(const TAX& other) = delete;
-	static TAX* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	TAX(void) {}
-	static TAX* sInstance;
+	static void execute(MOS6502& cpu) {
+		Byte accumulator = cpu.getAccumulator();
+		setCpuFlag(cpu, ProcessorFlag::FLAG_ZERO, accumulator == 0);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_NEGATIVE, accumulator & ProcessorFlag::FLAG_NEGATIVE);
+		setCpuX(cpu, accumulator);
+	}
 };
 
 class TAY : public Operation {
 public:
-
-	void operator=(const TAY& other) = delete;
-	static TAY* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	TAY(void) {}
-	static TAY* sInstance;
+	static void execute(MOS6502& cpu) {
+		Byte accumulator = cpu.getAccumulator();
+		setCpuFlag(cpu, ProcessorFlag::FLAG_ZERO, accumulator == 0);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_NEGATIVE, accumulator & ProcessorFlag::FLAG_NEGATIVE);
+		setCpuY(cpu, accumulator);
+	}
 };
 
 class TXA : public Operation {
 public:
-
-	void operator=(const TXA& other) = delete;
-	static TXA* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	TXA(void) {}
-	static TXA* sInstance;
+	static void execute(MOS6502& cpu) {
+		Byte X = cpu.getX();
+		setCpuFlag(cpu, ProcessorFlag::FLAG_ZERO, X == 0);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_NEGATIVE, X & ProcessorFlag::FLAG_NEGATIVE);
+		setCpuAccumulator(cpu, X);
+	}
 };
 
 class TYA : public Operation {
 public:
-
-	void operator=(const TYA& other) = delete;
-	static TYA* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	TYA(void) {}
-	static TYA* sInstance;
+	static void execute(MOS6502& cpu) {
+		Byte Y = cpu.getY();
+		setCpuFlag(cpu, ProcessorFlag::FLAG_ZERO, Y == 0);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_NEGATIVE, Y & ProcessorFlag::FLAG_NEGATIVE);
+		setCpuAccumulator(cpu, Y);
+	}
 };
 
-
 /* STACK OPERATIONS */
 
-
 class TSX : public Operation {
 public:
-
-	void operator=(const TSX& other) = delete;
-	static TSX* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	TSX(void) {}
-	static TSX* sInstance;
+	static void execute(MOS6502& cpu) {
+		Byte data = cpu.getStackPointer();
+		setCpuFlag(cpu, ProcessorFlag::FLAG_ZERO, data == 0);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_NEGATIVE, data & ProcessorFlag::FLAG_NEGATIVE);
+		setCpuX(cpu, data);
+	}
 };
 
 class TXS : public Operation {
 public:
-
-	void operator=(const TXS& other) = delete;
-	static TXS* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	TXS(void) {}
-	static TXS* sInstance;
+	static void execute(MOS6502& cpu) {
+		setCpuStackPointer(cpu, cpu.getX());
+	}
 };
 
 class PHA : public Operation {
 public:
-
-	void operator=(const PHA& other) = delete;
-	static PHA* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	PHA(void) {}
-	static PHA* sInstance;
+	static void execute(MOS6502& cpu) {
+		pushStack(cpu, cpu.getAccumulator());
+	}
 };
 
 class PHP : public Operation {
 public:
-
-	void operator=(const PHP& other) = delete;
-	static PHP* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	PHP(void) {}
-	static PHP* sInstance;
+	static void execute(MOS6502& cpu) {
+		//break flag is always added to the pushed copy of processor status
+		pushStack(cpu, cpu.getProcessorStatus() | ProcessorFlag::FLAG_BREAK);
+	}
 };
 
 class PLA : public Operation {
 public:
-
-	void operator=(const PLA& other) = delete;
-	static PLA* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	PLA(void) {}
-	static PLA* sInstance;
+	static void execute(MOS6502& cpu) {
+		Byte data = fetchStack(cpu);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_ZERO, data == 0);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_NEGATIVE, data & ProcessorFlag::FLAG_NEGATIVE);
+		setCpuAccumulator(cpu, data);
+	}
 };
 
 class PLP : public Operation {
 public:
-
-	void operator=(const PLP& other) = delete;
-	static PLP* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	PLP(void) {}
-	static PLP* sInstance;
+	static void execute(MOS6502& cpu) {
+		setCpuStatus(cpu, fetchStack(cpu) | ProcessorFlag::FLAG_DEFAULT);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_BREAK, false);
+	}
 };
 
-
 /* LOGICAL */
 
-
 class AND : public Operation {
 public:
-
-	void operator=(const AND& other) = delete;
-	static AND* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	AND(void) {}
-	static AND* sInstance;
+	static void execute(MOS6502& cpu) {
+		Byte accumulator = cpu.getAccumulator();
+		Byte result = accumulator & cpu.getFetched();
+		setCpuFlag(cpu, ProcessorFlag::FLAG_ZERO, result == 0);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_NEGATIVE, result & ProcessorFlag::FLAG_NEGATIVE);
+		setCpuAccumulator(cpu, result);
+		if (pageCrossed(cpu)) { addCycles(cpu, 1); }
+	}
 };
 
 class EOR : public Operation {
 public:
-
-	void operator=(const EOR& other) = delete;
-	static EOR* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	EOR(void) {}
-	static EOR* sInstance;
+	static void execute(MOS6502& cpu) {
+		Byte accumulator = cpu.getAccumulator();
+		Byte result = accumulator ^ cpu.getFetched();
+		setCpuFlag(cpu, ProcessorFlag::FLAG_ZERO, result == 0);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_NEGATIVE, result & ProcessorFlag::FLAG_NEGATIVE);
+		setCpuAccumulator(cpu, result);
+		if (pageCrossed(cpu)) { addCycles(cpu, 1); }
+	}
 };
 
 class ORA : public Operation {
 public:
-
-	void operator=(const ORA& other) = delete;
-	static ORA* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	ORA(void) {}
-	static ORA* sInstance;
+	static void execute(MOS6502& cpu) {
+		Byte accumulator = cpu.getAccumulator();
+		Byte result = accumulator | cpu.getFetched();
+		setCpuFlag(cpu, ProcessorFlag::FLAG_ZERO, result == 0);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_NEGATIVE, result & ProcessorFlag::FLAG_NEGATIVE);
+		setCpuAccumulator(cpu, result);
+		if (pageCrossed(cpu)) { addCycles(cpu, 1); }
+	}
 };
 
 class BIT : public Operation {
 public:
-
-	void operator=(const BIT& other) = delete;
-	static BIT* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	BIT(void) {}
-	static BIT* sInstance;
+	static void execute(MOS6502& cpu) {
+		Byte data = cpu.getFetched();
+		Byte result = cpu.getAccumulator() & data;
+		setCpuFlag(cpu, ProcessorFlag::FLAG_ZERO, result == 0);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_OVERFLOW, data & ProcessorFlag::FLAG_OVERFLOW);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_NEGATIVE, data & ProcessorFlag::FLAG_NEGATIVE);
+	}
 };
 
-
 /* ARITHMETIC */
 
-
 class ADC : public Operation {
 public:
+	static void execute(MOS6502& cpu) {
+		Byte accumulator = cpu.getAccumulator();
+		Byte data = cpu.getFetched();
+		Word result = accumulator + data;
+		if (cpu.getProcessorStatus() & ProcessorFlag::FLAG_CARRY) { ++result; }
+
+		setCpuFlag(cpu, ProcessorFlag::FLAG_CARRY, result > 0xff);
+		result = (Byte)result;
 
-	void operator=(const ADC& other) = delete;
-	static ADC* getInstance(void);
-	void execute(MOS6502& cpu);
+		//set true if the signs of accumulator and data are the same, but the sign of the result is different
+		bool overflow = ~(accumulator & ProcessorFlag::FLAG_NEGATIVE ^ data & ProcessorFlag::FLAG_NEGATIVE) & 
+						(accumulator & ProcessorFlag::FLAG_NEGATIVE ^ result & ProcessorFlag::FLAG_NEGATIVE);
 
-private:
-	ADC(void) {}
-	static ADC* sInstance;
+		setCpuFlag(cpu, ProcessorFlag::FLAG_ZERO, result == 0);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_OVERFLOW, overflow);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_NEGATIVE, result & ProcessorFlag::FLAG_NEGATIVE);
+		setCpuAccumulator(cpu, (Byte)result);
+		if (pageCrossed(cpu)) { addCycles(cpu, 1); }
+	}
 };
 
 class SBC : public Operation {
 public:
+	static void execute(MOS6502& cpu) { //same as ADC but with the binary ~ of fetched data
+		Byte accumulator = cpu.getAccumulator();
+		Byte data = ~cpu.getFetched();
+		Word result = accumulator + data;
+		if (cpu.getProcessorStatus() & ProcessorFlag::FLAG_CARRY) { ++result; }
 
-	void operator=(const SBC& other) = delete;
-	static SBC* getInstance(void);
-	void execute(MOS6502& cpu);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_CARRY, result > 0xff);
+		result = (Byte)result;
 
-private:
-	SBC(void) {}
-	static SBC* sInstance;
+		//set true if the signs of accumulator and data are the same, but the sign of the result is different
+		bool overflow = ~(accumulator & ProcessorFlag::FLAG_NEGATIVE ^ data & ProcessorFlag::FLAG_NEGATIVE) & 
+						(accumulator & ProcessorFlag::FLAG_NEGATIVE ^ result & ProcessorFlag::FLAG_NEGATIVE);
+
+		setCpuFlag(cpu, ProcessorFlag::FLAG_ZERO, result == 0);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_OVERFLOW, overflow);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_NEGATIVE, result & ProcessorFlag::FLAG_NEGATIVE);
+		setCpuAccumulator(cpu, (Byte)result);
+		if (pageCrossed(cpu)) { addCycles(cpu, 1); }
+	}
 };
 
 class CMP : public Operation {
 public:
-
-	void operator=(const CMP& other) = delete;
-	static CMP* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	CMP(void) {}
-	static CMP* sInstance;
+	static void execute(MOS6502& cpu) {
+		Byte data = cpu.getFetched();
+		Byte Accumulator = cpu.getAccumulator();
+		Byte result = Accumulator - data;
+		setCpuFlag(cpu, ProcessorFlag::FLAG_ZERO, result == 0);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_CARRY, Accumulator >= data); //comparison of unsigned values
+		setCpuFlag(cpu, ProcessorFlag::FLAG_NEGATIVE, result & (1 << 7));
+		if (pageCrossed(cpu)) { addCycles(cpu, 1); }
+	}
 };
 
 class CPX : public Operation {
 public:
-
-	void operator=(const BIT& other) = delete;
-	static CPX* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	CPX(void) {}
-	static CPX* sInstance;
+	static void execute(MOS6502& cpu) {
+		Byte data = cpu.getFetched();
+		Byte X = cpu.getX();
+		Byte result = X - data;
+		setCpuFlag(cpu, ProcessorFlag::FLAG_ZERO, result == 0);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_CARRY, X >= data); //comparison of unsigned values
+		setCpuFlag(cpu, ProcessorFlag::FLAG_NEGATIVE, result & (1 << 7));
+	}
 };
 
 class CPY : public Operation {
 public:
-
-	void operator=(const CPY& other) = delete;
-	static CPY* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	CPY(void) {}
-	static CPY* sInstance;
+	static void execute(MOS6502& cpu) {
+		Byte data = cpu.getFetched();
+		Byte Y = cpu.getY();
+		Byte result = Y - data;
+		setCpuFlag(cpu, ProcessorFlag::FLAG_ZERO, result == 0);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_CARRY, Y >= data); //comparison of unsigned values
+		setCpuFlag(cpu, ProcessorFlag::FLAG_NEGATIVE, result & (1 << 7));
+	}
 };
 
-
 /* INCREMENTS & DECREMENTS */
 
-
 class INC : public Operation {
 public:
-
-void operator=(const INC& other) = delete;
-	static INC* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	INC(void) {}
-	static INC* sInstance;
+	static void execute(MOS6502& cpu) {
+		Byte result = cpu.getFetched() + 1;
+		setCpuFlag(cpu, ProcessorFlag::FLAG_ZERO, result == 0);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_NEGATIVE, result & ProcessorFlag::FLAG_NEGATIVE);
+		writeMemory(cpu, result, cpu.getFetchedAddress());
+	}
 };
 
 class INX : public Operation {
 public:
-
-	void operator=(const INX& other) = delete;
-	static INX* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	INX(void) {}
-	static INX* sInstance;
+	static void execute(MOS6502& cpu) {
+		Byte result = cpu.getX() + 1;
+		setCpuFlag(cpu, ProcessorFlag::FLAG_ZERO, result == 0);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_NEGATIVE, result & ProcessorFlag::FLAG_NEGATIVE);
+		setCpuX(cpu, result);
+	}
 };
 
 class INY : public Operation {
 public:
-
-	void operator=(const INY& other) = delete;
-	static INY* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	INY(void) {}
-	static INY* sInstance;
+	static void execute(MOS6502& cpu) {
+		Byte result = cpu.getY() + 1;
+		setCpuFlag(cpu, ProcessorFlag::FLAG_ZERO, result == 0);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_NEGATIVE, result & ProcessorFlag::FLAG_NEGATIVE);
+		setCpuY(cpu, result);
+	}
 };
 
 class DEC : public Operation {
 public:
-
-	void operator=(const DEC& other) = delete;
-	static DEC* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	DEC(void) {}
-	static DEC* sInstance;
+	static void execute(MOS6502& cpu) {
+		Byte result = cpu.getFetched() - 1;
+		setCpuFlag(cpu, ProcessorFlag::FLAG_ZERO, result == 0);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_NEGATIVE, result & ProcessorFlag::FLAG_NEGATIVE);
+		writeMemory(cpu, result, cpu.getFetchedAddress());
+	}
 };
 
 class DEX : public Operation {
 public:
-
-	void operator=(const DEX& other) = delete;
-	static DEX* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	DEX(void) {}
-	static DEX* sInstance;
+	static void execute(MOS6502& cpu) {
+		Byte result = cpu.getX() - 1;
+		setCpuFlag(cpu, ProcessorFlag::FLAG_ZERO, result == 0);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_NEGATIVE, result & ProcessorFlag::FLAG_NEGATIVE);
+		setCpuX(cpu, result);
+	}
 };
 
 class DEY : public Operation {
 public:
-
-	void operator=(const DEY& other) = delete;
-	static DEY* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	DEY(void) {}
-	static DEY* sInstance;
+	static void execute(MOS6502& cpu) {
+		Byte result = cpu.getY() - 1;
+		setCpuFlag(cpu, ProcessorFlag::FLAG_ZERO, result == 0);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_NEGATIVE, result & ProcessorFlag::FLAG_NEGATIVE);
+		setCpuY(cpu, result);
+	}
 };
 
-
 /* SHIFTS */
 
-
 class ASL : public Operation {
 public:
+	static void execute(MOS6502& cpu) {
+		Byte data = cpu.getFetched();
+		setCpuFlag(cpu, ProcessorFlag::FLAG_CARRY, data & (1 << 7));
 
-	void operator=(const ASL& other) = delete;
-	static ASL* getInstance(void);
-	void execute(MOS6502& cpu);
+		data <<= 1;
+		setCpuFlag(cpu, ProcessorFlag::FLAG_ZERO, data == 0);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_NEGATIVE, data & ProcessorFlag::FLAG_NEGATIVE);
 
-private:
-	ASL(void) {}
-	static ASL* sInstance;
+		if (cpu.isAccAddressed()) { setCpuAccumulator(cpu, data); } 
+		else { writeMemory(cpu, data, cpu.getFetchedAddress()); }
+	}
 };
 
 class LSR : public Operation {
 public:
+	static void execute(MOS6502& cpu) {
+		Byte data = cpu.getFetched();
+		setCpuFlag(cpu, ProcessorFlag::FLAG_CARRY, data & 1);
 
-	void operator=(const LSR& other) = delete;
-	static LSR* getInstance(void);
-	void execute(MOS6502& cpu);
+		data >>= 1;
+		setCpuFlag(cpu, ProcessorFlag::FLAG_ZERO, data == 0);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_NEGATIVE, false); //bit 7 is always 0
 
-private:
-	LSR(void) {}
-	static LSR* sInstance;
+		if (cpu.isAccAddressed()) { setCpuAccumulator(cpu, data); } 
+		else { writeMemory(cpu, data, cpu.getFetchedAddress()); }
+	}
 };
 
 class ROL : public Operation {
 public:
+	static void execute(MOS6502& cpu) {
+		Byte data = cpu.getFetched();
+		Byte newCarry = data & (1 << 7);
+
+		data <<= 1;
+		if (cpu.getProcessorStatus() & ProcessorFlag::FLAG_CARRY) { ++data; }
 
-	void operator=(const ROL& other) = delete;
-	static ROL* getInstance(void);
-	void execute(MOS6502& cpu);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_CARRY, newCarry);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_ZERO, data == 0);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_NEGATIVE, data & ProcessorFlag::FLAG_NEGATIVE);
 
-private:
-	ROL(void) {}
-	static ROL* sInstance;
+		if (cpu.isAccAddressed()) { setCpuAccumulator(cpu, data); } 
+		else { writeMemory(cpu, data, cpu.getFetchedAddress()); }
+	}
 };
 
 class ROR : public Operation {
 public:
+	static void execute(MOS6502& cpu) {
+		Byte data = cpu.getFetched();
+		Byte newCarry = data & 1;
 
-	void operator=(const ROR& other) = delete;
-	static ROR* getInstance(void);
-	void execute(MOS6502& cpu);
+		data >>= 1;
+		if (cpu.getProcessorStatus() & ProcessorFlag::FLAG_CARRY) { data |= (1 << 7); }
 
-private:
-	ROR(void) {}
-	static ROR* sInstance;
-};
+		setCpuFlag(cpu, ProcessorFlag::FLAG_CARRY, newCarry);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_ZERO, data == 0);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_NEGATIVE, data & ProcessorFlag::FLAG_NEGATIVE);
 
+		if (cpu.isAccAddressed()) { setCpuAccumulator(cpu, data); } 
+		else { writeMemory(cpu, data, cpu.getFetchedAddress()); }
+	}
+};
 
 /* JUMPS & CALLS */
 
-
 class JMP : public Operation {
 public:
+	inline static constexpr bool CONTROL_FLOW = true;
 
-	void operator=(const JMP& other) = delete;
-	static JMP* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	JMP(void) {}
-	static JMP* sInstance;
+	static void execute(MOS6502& cpu) {
+		setCpuProgramCounter(cpu, cpu.getFetchedAddress());
+	}
 };
 
 class JSR : public Operation {
 public:
+	inline static constexpr bool CONTROL_FLOW = true;
 
-	void operator=(const JSR& other) = delete;
-	static JSR* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	JSR(void) {}
-	static JSR* sInstance;
+	static void execute(MOS6502& cpu) {
+		Word returnAddress = cpu.getProgramCounter() - 1; //the address stored should be target address - 1
+		pushStack(cpu, returnAddress >> 8);
+		pushStack(cpu, (Byte)returnAddress);
+		setCpuProgramCounter(cpu, cpu.getFetchedAddress());
+	}
 };
 
 class RTS : public Operation {
 public:
+	inline static constexpr bool CONTROL_FLOW = true;
 
-	void operator=(const RTS& other) = delete;
-	static RTS* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	RTS(void) {}
-	static RTS* sInstance;
+	static void execute(MOS6502& cpu) {
+		Byte lowByte = fetchStack(cpu);
+		Word address = (fetchStack(cpu) << 8) | lowByte;
+		setCpuProgramCounter(cpu, ++address); //the address stored is target address - 1
+	}
 };
 
-
 /* BRANCHES */
 
-
 class BCC : public Operation {
 public:
+	inline static constexpr bool CONTROL_FLOW = true;
 
-	void operator=(const BCC& other) = delete;
-	static BCC* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	BCC(void) {}
-	static BCC* sInstance;
+	static void execute(MOS6502& cpu) {
+		if (cpu.getProcessorStatus() & ProcessorFlag::FLAG_CARRY) { return; }
+		if (pageCrossed(cpu)) { addCycles(cpu, 2); }
+		else { addCycles(cpu, 1); }
+		setCpuProgramCounter(cpu, cpu.getFetchedAddress());
+	}
 };
 
 class BCS : public Operation {
 public:
+	inline static constexpr bool CONTROL_FLOW = true;
 
-	void operator=(const BCS& other) = delete;
-	static BCS* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	BCS(void) {}
-	static BCS* sInstance;
+	static void execute(MOS6502& cpu) {
+		if ( !(cpu.getProcessorStatus() & ProcessorFlag::FLAG_CARRY) ) { return; }
+		if (pageCrossed(cpu)) { addCycles(cpu, 2); }
+		else { addCycles(cpu, 1); }
+		setCpuProgramCounter(cpu, cpu.getFetchedAddress());
+	}
 };
 
 class BEQ : public Operation {
 public:
+	inline static constexpr bool CONTROL_FLOW = true;
 
-	void operator=(const BEQ& other) = delete;
-	static BEQ* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	BEQ(void) {}
-	static BEQ* sInstance;
+	static void execute(MOS6502& cpu) {
+		if ( !(cpu.getProcessorStatus() & ProcessorFlag::FLAG_ZERO) ) { return; }
+		if (pageCrossed(cpu)) { addCycles(cpu, 2); }
+		else { addCycles(cpu, 1); }
+		setCpuProgramCounter(cpu, cpu.getFetchedAddress());
+	}
 };
 
 class BMI : public Operation {
 public:
+	inline static constexpr bool CONTROL_FLOW = true;
 
-	void operator=(const BMI& other) = delete;
-	static BMI* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	BMI(void) {}
-	static BMI* sInstance;
+	static void execute(MOS6502& cpu) {
+		if ( !(cpu.getProcessorStatus() & ProcessorFlag::FLAG_NEGATIVE) ) { return; }
+		if (pageCrossed(cpu)) { addCycles(cpu, 2); }
+		else { addCycles(cpu, 1); }
+		setCpuProgramCounter(cpu, cpu.getFetchedAddress());
+	}
 };
 
 class BNE : public Operation {
 public:
+	inline static constexpr bool CONTROL_FLOW = true;
 
-	void operator=(const BNE& other) = delete;
-	static BNE* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	BNE(void) {}
-	static BNE* sInstance;
+	static void execute(MOS6502& cpu) {
+		if (cpu.getProcessorStatus() & ProcessorFlag::FLAG_ZERO) { return; }
+		if (pageCrossed(cpu)) { addCycles(cpu, 2); }
+		else { addCycles(cpu, 1); }
+		setCpuProgramCounter(cpu, cpu.getFetchedAddress());
+	}
 };
 
 class BPL : public Operation {
 public:
+	inline static constexpr bool CONTROL_FLOW = true;
 
-	void operator=(const BPL& other) = delete;
-	static BPL* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	BPL(void) {}
-	static BPL* sInstance;
+	static void execute(MOS6502& cpu) {
+		if (cpu.getProcessorStatus() & ProcessorFlag::FLAG_NEGATIVE) { return; }
+		if (pageCrossed(cpu)) { addCycles(cpu, 2); }
+		else { addCycles(cpu, 1); }
+		setCpuProgramCounter(cpu, cpu.getFetchedAddress());
+	}
 };
 
 class BVC : public Operation {
 public:
+	inline static constexpr bool CONTROL_FLOW = true;
 
-	void operator=(const BVC& other) = delete;
-	static BVC* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	BVC(void) {}
-	static BVC* sInstance;
+	static void execute(MOS6502& cpu) {
+		if (cpu.getProcessorStatus() & ProcessorFlag::FLAG_OVERFLOW) { return; }
+		if (pageCrossed(cpu)) { addCycles(cpu, 2); }
+		else { addCycles(cpu, 1); }
+		setCpuProgramCounter(cpu, cpu.getFetchedAddress());
+	}
 };
 
 class BVS : public Operation {
 public:
+	inline static constexpr bool CONTROL_FLOW = true;
 
-	void operator=(const BVS& other) = delete;
-	static BVS* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	BVS(void) {}
-	static BVS* sInstance;
+	static void execute(MOS6502& cpu) {
+		if ( !(cpu.getProcessorStatus() & ProcessorFlag::FLAG_OVERFLOW) ) { return; }
+		if (pageCrossed(cpu)) { addCycles(cpu, 2); }
+		else { addCycles(cpu, 1); }
+		setCpuProgramCounter(cpu, cpu.getFetchedAddress());
+	}
 };
 
-
 /* STATUS FLAG CHANGES */
 
-
 class CLC : public Operation {
 public:
-
-	void operator=(const CLC& other) = delete;
-	static CLC* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	CLC(void) {}
-	static CLC* sInstance;
+	static void execute(MOS6502& cpu) {
+		setCpuFlag(cpu, ProcessorFlag::FLAG_CARRY, false);
+	}
 };
 
 class CLD : public Operation {
 public:
-
-	void operator=(const CLD& other) = delete;
-	static CLD* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	CLD(void) {}
-	static CLD* sInstance;
+	static void execute(MOS6502& cpu) {
+		setCpuFlag(cpu, ProcessorFlag::FLAG_DECIMAL, false);
+	}
 };
 
 class CLI : public Operation {
 public:
-
-	void operator=(const CLI& other) = delete;
-	static CLI* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	CLI(void) {}
-	static CLI* sInstance;
+	static void execute(MOS6502& cpu) {
+		setCpuFlag(cpu, ProcessorFlag::FLAG_INTERRUPT_DISABLE, false);
+	}
 };
 
 class CLV : public Operation {
 public:
-
-	void operator=(const CLV& other) = delete;
-	static CLV* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	CLV(void) {}
-	static CLV* sInstance;
+	static void execute(MOS6502& cpu) {
+		setCpuFlag(cpu, ProcessorFlag::FLAG_OVERFLOW, false);
+	}
 };
 
 class SEC : public Operation {
 public:
-
-	void operator=(const SEC& other) = delete;
-	static SEC* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	SEC(void) {}
-	static SEC* sInstance;
+	static void execute(MOS6502& cpu) {
+		setCpuFlag(cpu, ProcessorFlag::FLAG_CARRY, true);
+	}
 };
 
 class SED : public Operation {
 public:
-
-	void operator=(const SED& other) = delete;
-	static SED* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	SED(void) {}
-	static SED* sInstance;
+	static void execute(MOS6502& cpu) {
+		setCpuFlag(cpu, ProcessorFlag::FLAG_DECIMAL, true);
+	}
 };
 
 class SEI : public Operation {
 public:
-
-	void operator=(const SEI& other) = delete;
-	static SEI* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	SEI(void) {}
-	static SEI* sInstance;
+	static void execute(MOS6502& cpu) {
+		setCpuFlag(cpu, ProcessorFlag::FLAG_INTERRUPT_DISABLE, true);
+	}
 };
 
-
-/* SYSTEM FUNCTIONS */
+/* SYSTEM OPERATIONS */
 
 class BRK : public Operation {
 public:
+	inline static constexpr bool CONTROL_FLOW = true;
 
-	void operator=(const BRK& other) = delete;
-	static BRK* getInstance(void);
-	void execute(MOS6502& cpu);
+	static void execute(MOS6502& cpu) {
+		Word programCounter = cpu.getProgramCounter() + 1; //seems to be a "required" bug
+		Byte processorStatus = cpu.getProcessorStatus();
+		pushStack(cpu, programCounter >> 8);
+		pushStack(cpu, (Byte)programCounter);
+		pushStack(cpu, processorStatus | ProcessorFlag::FLAG_BREAK);
+		setCpuFlag(cpu, ProcessorFlag::FLAG_BREAK, true);
 
-private:
-	BRK(void) {}
-	static BRK* sInstance;
+		Byte lowByte = fetchByte(cpu, 0xFFFE);
+		setCpuProgramCounter(cpu, (fetchByte(cpu, 0xFFFF) << 8) | lowByte);
+		setCpuStatus(cpu, processorStatus | ProcessorFlag::FLAG_INTERRUPT_DISABLE);
+	}
 };
 
 class NOP : public Operation {
 public:
-
-	void operator=(const NOP&other) = delete;
-	static NOP* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	NOP(void) {}
-	static NOP* sInstance;
+	static void execute(MOS6502& cpu) {
+		/* DO NOTHING */
+	}
 };
 
 class RTI : public Operation {
 public:
+	inline static constexpr bool CONTROL_FLOW = true;
 
-	void operator=(const RTI& other) = delete;
-	static RTI* getInstance(void);
-	void execute(MOS6502& cpu);
-
-private:
-	RTI(void) {}
-	static RTI* sInstance;
+	static void execute(MOS6502& cpu) {
+		setCpuStatus(cpu, fetchStack(cpu));
+		Byte lowByte = fetchStack(cpu);
+		setCpuProgramCounter(cpu, (fetchStack(cpu) << 8) | lowByte);
+	}
 };
 
 #endif // !OPERATION_H
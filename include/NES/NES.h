@@ -1,16 +1,65 @@
 #ifndef NES_H
 #define NES_H
 
+#include <cstddef>
+#include <cstdint>
+
 #include "NES/MOS6502/MOS6502.h"
 #include "NES/PPU2C02/PPU2C02.h"
 #include "NES/Buses/CPUBus.h"
 #include "NES/Buses/PPUBus.h"
 #include "NES/APU/APU.h"
 #include "NES/Cartridge/Cartridge.h"
+#include "NES/Scheduler.h"
 
-#include "IO/Window.h"
+#include "IO/Frontend.h"
 #include "IO/Joypad.h"
 
+/**
+* Output of the emulation
+* produced by a single call
+* to NES::runFrame() or
+* NES::runCycles(). Pointers
+* stay valid until the next
+* call to either of them.
+*/
+struct Frame {
+
+	/**
+	* Frame buffer holding 256x240 
+	* packed RGBA pixels, row by row.
+	* 
+	* @see Colour::rgba
+	*/
+	const uint32_t* pixels = nullptr;
+
+	/** Mono 16 bit audio samples */
+	const int16_t* samples = nullptr;
+
+	/** Number of audio samples */
+	size_t sampleCount = 0;
+
+	/** 
+	* True if the PPU skipped drawing
+	* the frame. The frame buffer still
+	* holds the last drawn frame then.
+	* 
+	* @see NES::setFrameSkip
+	*/
+	bool skipped = false;
+
+	/**
+	* 64 bit hash of the pixels of
+	* the last finished frame. Equal
+	* frames have equal hashes, so they
+	* can be compared without storing
+	* the pixels.
+	* 
+	* @see PPU2C02::getFrameHash
+	*/
+	uint64_t hash = 0;
+};
+
 /**
 * Class that emulates the
 * behaviour of the NES (
@@ -22,37 +71,278 @@ public:
 
 	using Byte = unsigned char;
 	using Word = unsigned short;
+	using Cycle = Scheduler::Cycle;
 
 	/**
 	* Class constructor. It initializes
 	* an instance of the class with
 	* given parameters. It creates
 	* all of the necessary components
-	* and starts an application window.
+	* and connects them to the frontend.
 	* 
 	* @param cartridge cartridge object
 	*	containing the iNES file data
+	* @param frontend video, audio and
+	*	input sink of the emulator
+	* 
+	* @see Frontend
 	*/
-	NES(Cartridge& cartridge);
+	NES(Cartridge& cartridge, Frontend* frontend);
 
 	/**
-	* Class destructor. It destroys
-	* the created application window.
+	* Starts the main app loop. The
+	* loop runs until the frontend
+	* gets closed. Every emulated
+	* frame is handed to the frontend
+	* together with its audio samples,
+	* and the audio sample rate follows
+	* the ratio asked for by the frontend.
 	*/
-	~NES(void);
+	void run(void);
 
 	/**
-	* Starts the main app loop.
+	* Runs the emulation until the
+	* PPU finishes drawing the visible
+	* part of the frame and enters the
+	* vertical blank.
+	* 
+	* @return finished frame and the
+	*	audio samples generated along
+	*	with it
+	* 
+	* @see Frame
 	*/
-	void run(void);
+	Frame runFrame(void);
+
+	/**
+	* Runs the emulation for a given
+	* number of CPU cycles.
+	* 
+	* @param cycles number of CPU 
+	*	cycles to run
+	* 
+	* @return current, possibly partially
+	*	drawn frame and the audio samples
+	*	generated during these cycles
+	* 
+	* @see Frame
+	*/
+	Frame runCycles(const unsigned long& cycles);
+
+	/**
+	* Returns the number of CPU
+	* cycles emulated so far.
+	* 
+	* @return number of CPU cycles
+	*/
+	Cycle getCpuCycles(void) const { return mClock / CPU_CLOCK_DIVIDER; }
+
+	/**
+	* Returns the number of CPU
+	* cycles, which were skipped
+	* because the CPU was waiting
+	* for an interrupt in an idle loop.
+	* 
+	* @return number of skipped
+	*	CPU cycles
+	* 
+	* @see MOS6502::getIdleCycles
+	*/
+	Cycle getIdleCycles(void) const { return mCpu.getIdleCycles(); }
+
+	/**
+	* Sets how often the frames are
+	* drawn, e.g. 3 draws every third
+	* frame. The emulation itself runs
+	* the same way for skipped frames.
+	* 
+	* @param interval number of frames
+	*	per drawn frame, 1 draws all
+	*	of them
+	* 
+	* @see PPU2C02::setFrameSkip
+	*/
+	void setFrameSkip(const unsigned int& interval) { mPpu.setFrameSkip(interval); }
+
+	/**
+	* Returns the number of frames
+	* that weren't drawn.
+	* 
+	* @return number of skipped frames
+	* 
+	* @see PPU2C02::getSkippedFrames
+	*/
+	unsigned long getSkippedFrames(void) const { return mPpu.getSkippedFrames(); }
+
+	/**
+	* Switches between rendering the
+	* scanlines nothing splits at once
+	* and rendering every scanline dot
+	* by dot. Both produce the same
+	* frames, the dot renderer is only
+	* slower. It's on by default.
+	* 
+	* @param enabled true to render the
+	*	whole scanlines at once
+	* 
+	* @see syncPpu
+	*/
+	void setScanlineRendering(const bool& enabled) { mScanlineRendering = enabled; }
+
+	/**
+	* Returns the CPU, so its
+	* registers can be inspected,
+	* e.g. when comparing the CPU
+	* cores with each other.
+	* 
+	* @return CPU of the emulator
+	*/
+	const MOS6502& getCpu(void) const { return mCpu; }
+
+	/**
+	* Returns the PPU, so its
+	* state can be inspected.
+	* 
+	* @return PPU of the emulator
+	*/
+	const PPU2C02& getPpu(void) const { return mPpu; }
+
+	/**
+	* Returns the 2KB of CPU RAM.
+	* 
+	* @return CPU RAM
+	* 
+	* @see CPUBus::getRam
+	*/
+	const Byte* getRam(void) const { return mCpuBus.getRam(); }
 
 private:
 
-	/** Clock counter */
-	Word mClock;
+	/** Number of master cycles per CPU cycle */
+	inline static constexpr Cycle CPU_CLOCK_DIVIDER = 3;
+
+	/** Number of master cycles per APU cycle */
+	inline static constexpr Cycle APU_CLOCK_DIVIDER = 6;
+
+	/**
+	* Runs the emulation until the
+	* master clock reaches a given
+	* cycle. All events due before
+	* that cycle are dispatched and
+	* the PPU and APU are clocked up 
+	* to it. In between they lag behind
+	* and catch up only when the CPU
+	* accesses them, or when the PPU
+	* is about to enter the vblank.
+	* 
+	* @param time master cycle at
+	*	which the emulation stops
+	* 
+	* @see mScheduler
+	*/
+	void runUntil(const Cycle& time);
+
+	/**
+	* Clocks the PPU until the PPU
+	* clock reaches a given master cycle.
+	* If the PPU is already there, the
+	* call has no effect. Scanlines
+	* which fit before that cycle as
+	* a whole are rendered at once.
+	* Only the ones split by a PPU 
+	* access, like a raster split,
+	* are clocked dot by dot, or all
+	* of them if the scanline rendering
+	* is switched off.
+	* 
+	* @param time master cycle up
+	*	to which the PPU is clocked
+	* 
+	* @see mPpuClock
+	* @see PPU2C02::clockScanline
+	*/
+	void syncPpu(const Cycle& time);
+
+	/**
+	* Moves the APU forward by all
+	* of the APU cycles started before
+	* a given master cycle. The APU only
+	* catches up with the elapsed time
+	* when it gets accessed, when its
+	* frame sequencer steps and when
+	* the samples are collected. If the 
+	* APU is already there, the call
+	* has no effect.
+	* 
+	* @param time master cycle up
+	*	to which the APU is moved
+	* 
+	* @see mApuClock
+	*/
+	void syncApu(const Cycle& time);
+
+	/**
+	* Returns the master cycle
+	* at which the CPU executes its
+	* current instruction. While the CPU
+	* runs a batch of instructions, it
+	* is ahead of the scheduler.
+	* 
+	* @return master cycle of the 
+	*	CPU's current instruction
+	*/
+	Cycle getCpuTime(void) const { return mScheduler.getNow() + CPU_CLOCK_DIVIDER * mCpu.getRunCycles(); }
+
+	/**
+	* Handles a dispatched event
+	* and schedules its follow-up.
+	* 
+	* @param event dispatched event
+	* @param time master cycle at
+	*	which the event was due
+	* @param limit master cycle of the
+	*	next event or of the end of the
+	*	emulation run, whichever comes first
+	* 
+	* @see SchedulerEvent
+	*/
+	void handleEvent(const SchedulerEvent& event, const Cycle& time, const Cycle& limit);
+
+	/**
+	* Collects the output of 
+	* the emulation.
+	* 
+	* @return current frame and
+	*	generated audio samples
+	*/
+	Frame getFrame(void) const;
+
+	/** Master cycle up to which the emulation has run */
+	Cycle mClock;
+
+	/** Master cycle of the next PPU dot */
+	Cycle mPpuClock;
+
+	/** Master cycle of the next APU cycle */
+	Cycle mApuClock;
+
+	/**
+	* Number of cycles left of the
+	* instruction that started the
+	* DMA transfer. The CPU resumes
+	* after them once the transfer
+	* is finished.
+	*/
+	unsigned int mDmaResumeCycles;
+
+	/** Flag indicating if the whole scanlines are rendered at once */
+	bool mScanlineRendering;
+
+	/** Event scheduler */
+	Scheduler mScheduler;
 
-	/** Application window */
-	Window* mWindow;
+	/** Video, audio and input sink */
+	Frontend* mFrontend;
 
 	/** Audio Processing Unit */
 	APU mApu;
@@ -64,6 +64,19 @@ public:
     */
     Byte blue(void) const { return mB; }
 
+    /**
+    * Returns the colour packed
+    * into a 32 bit RGBA value.
+    * In memory the bytes are laid
+    * out as red, green, blue and
+    * alpha on little endian hosts.
+    * 
+    * @return packed RGBA colour
+    */
+    uint32_t rgba(void) const { 
+        return mR | (mG << 8) | (mB << 16) | (0xFFu << 24); 
+    }
+
 private:
 
     /** Red value of the colour */
@@ -87,7 +100,28 @@ class ColourLUT {
 
     using Byte = uint8_t;
 
-    friend class PPU2C02;   //only PPU can create this LUT
+    friend class PPUBus;    //only the PPU bus can create this LUT
+
+    /**
+    * Class constructor. Precomputes
+    * the packed RGBA colours for
+    * every combination of the
+    * colour emphasis bits.
+    */
+    ColourLUT(void) {
+        for (int emphasis = 0; emphasis < 8; ++emphasis) {
+            for (int code = 0; code < 64; ++code) {
+                const Colour& colour = mColours[code];
+                Byte red = colour.red(), green = colour.green(), blue = colour.blue();
+                if ((code & 0xE) != 0xE) {  //the black columns aren't emphasised
+                    if (emphasis & ~EMPHASIS_RED & 0x7) { red = this->attenuate(red); }
+                    if (emphasis & ~EMPHASIS_GREEN & 0x7) { green = this->attenuate(green); }
+                    if (emphasis & ~EMPHASIS_BLUE & 0x7) { blue = this->attenuate(blue); }
+                }
+                mRgba[(emphasis << 6) | code] = Colour(red, green, blue).rgba();
+            }
+        }
+    }
 
     /**
     * Returns the colour for
@@ -99,6 +133,39 @@ class ColourLUT {
     */
     const Colour& operator[](const Byte& code) const { return mColours[code & 0x3F]; }
 
+    /**
+    * Returns the packed RGBA colour
+    * for the given colour code with
+    * the given colour emphasis.
+    * 
+    * @param emphasis emphasis bits
+    *   of the PPUMASK register
+    *   (red, green, blue from the LSB)
+    * @param code colour code
+    * 
+    * @return packed RGBA colour
+    * 
+    * @see Colour::rgba
+    */
+    uint32_t rgba(const Byte& emphasis, const Byte& code) const { 
+        return mRgba[((emphasis & 0x7) << 6) | (code & 0x3F)]; 
+    }
+
+    /**
+    * Darkens a colour channel
+    * that isn't emphasised.
+    * 
+    * @param value channel value
+    * 
+    * @return attenuated value
+    */
+    static Byte attenuate(const Byte& value) { return (value * 209) >> 8; }
+
+    /** Emphasis bits of the colour channels */
+    inline static constexpr Byte EMPHASIS_RED = 1 << 0;
+    inline static constexpr Byte EMPHASIS_GREEN = 1 << 1;
+    inline static constexpr Byte EMPHASIS_BLUE = 1 << 2;
+
     /**
     * An array of colours
     * supported by the 
@@ -174,6 +241,13 @@ class ColourLUT {
         Colour(0, 0, 0)
     };
 
+    /** 
+    * Packed RGBA colours for every 
+    * combination of the emphasis
+    * bits, 64 colours each.
+    */
+    uint32_t mRgba[512];
+
 };
 
 #endif // !COLOUR_LUT_H
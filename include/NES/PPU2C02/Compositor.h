@@ -0,0 +1,138 @@
+#ifndef COMPOSITOR_H
+#define COMPOSITOR_H
+
+#include <atomic>
+#include <cstdint>
+
+/**
+* Instruction sets the
+* compositor can use.
+*
+* @see Compositor
+*/
+enum InstructionSet : uint8_t {
+    INSTRUCTION_SET_SCALAR,
+    INSTRUCTION_SET_SSE2,
+    INSTRUCTION_SET_AVX2
+};
+
+/**
+* Composes whole scanlines of the
+* PPU out of the background and sprite
+* line buffers. For every pixel it picks
+* the background or the sprite pixel
+* according to their priority, looks
+* the result up in the palettes and
+* writes it as a packed RGBA colour.
+* The work is done with the widest
+* SIMD instruction set supported by
+* the host, which is detected on the
+* first call. Hosts without SSE2 or
+* AVX2 use a scalar fallback.
+*/
+class Compositor {
+public:
+
+    using Byte = uint8_t;
+
+    /**
+    * Composes a scanline. Pixels of
+    * the background buffer hold the
+    * colour index (palette * 4 + pixel)
+    * or 0 if they're transparent. Pixels
+    * of the sprite buffer hold the colour
+    * index on the lower 5 bits, are in
+    * front of the background if their
+    * MSB is set and are transparent if
+    * their 2 lowest bits are 0.
+    *
+    * @param background background pixels
+    * @param sprites sprite pixels
+    * @param colours 32 RGBA colours of
+    *   the palettes
+    * @param line composed pixels
+    * @param width number of pixels
+    */
+    static void compose(const Byte* background, const Byte* sprites, const uint32_t* colours, uint32_t* line, const int& width) {
+        sCompose.load(std::memory_order_relaxed)(background, sprites, colours, line, width);
+    }
+
+    /**
+    * Composes a scanline with a given
+    * instruction set instead of the one
+    * picked for the host, so the tests
+    * can compare them. The host has to
+    * support the instruction set.
+    *
+    * @param instructionSet used instruction set
+    *
+    * @see compose
+    * @see getInstructionSet
+    */
+    static void compose(const InstructionSet& instructionSet, const Byte* background, const Byte* sprites, 
+        const uint32_t* colours, uint32_t* line, const int& width) 
+    {
+        getComposeFunction(instructionSet)(background, sprites, colours, line, width);
+    }
+
+    /**
+    * Returns the instruction set
+    * picked for the host.
+    *
+    * @return used instruction set
+    */
+    static InstructionSet getInstructionSet(void);
+
+private:
+
+    using ComposeFunction = void (*)(const Byte*, const Byte*, const uint32_t*, uint32_t*, const int&);
+
+    /**
+    * Returns the composing function
+    * of an instruction set.
+    *
+    * @param instructionSet instruction set
+    *
+    * @return composing function
+    */
+    static ComposeFunction getComposeFunction(const InstructionSet& instructionSet);
+
+    /**
+    * Picks the composing function
+    * for the host, replaces itself
+    * with it and composes the line.
+    *
+    * @see compose
+    */
+    static void dispatch(const Byte* background, const Byte* sprites, const uint32_t* colours, uint32_t* line, const int& width);
+
+    /**
+    * Composes pixels one by one.
+    *
+    * @see compose
+    */
+    static void composeScalar(const Byte* background, const Byte* sprites, const uint32_t* colours, uint32_t* line, const int& width);
+
+    /**
+    * Resolves the priority of 16 pixels
+    * at a time and looks them up one by one.
+    *
+    * @see compose
+    */
+    static void composeSse2(const Byte* background, const Byte* sprites, const uint32_t* colours, uint32_t* line, const int& width);
+
+    /**
+    * Resolves the priority, looks up
+    * the colours and expands them to
+    * RGBA 32 pixels at a time.
+    *
+    * @see compose
+    */
+    static void composeAvx2(const Byte* background, const Byte* sprites, const uint32_t* colours, uint32_t* line, const int& width);
+
+    /** Composing function used for the host */
+    static std::atomic<ComposeFunction> sCompose;
+
+};
+
+#endif // !COMPOSITOR_H
@@ -4,9 +4,7 @@
 #include <cstdint>
 #include <functional>
 
-#include "IO/Window.h"
 #include "NES/Buses/PPUBus.h"
-#include "NES/PPU2C02/ColourLUT.h"
 
 /**
 * Stages of rendering
@@ -73,8 +71,10 @@ enum CTRL_REGISTER {
 * PPUMASK register.
 */
 enum MASK_REGISTER {
+    GRAYSCALE = 1 << 0,
     RENDER_BACKGROUND = 1 << 3,
-    RENDER_SPRITES = 1 << 4
+    RENDER_SPRITES = 1 << 4,
+    EMPHASIS = 0b11100000   //red, green and blue emphasis
 };
 
 /**
@@ -128,6 +128,18 @@ public:
     using Byte = uint8_t;
     using Word = uint16_t;
 
+    /** Width of the generated frame */
+    inline static constexpr int FRAME_WIDTH = 256;
+
+    /** Height of the generated frame */
+    inline static constexpr int FRAME_HEIGHT = 240;
+
+    /** Number of dots in a single scanline */
+    inline static constexpr long DOTS_PER_SCANLINE = 341;
+
+    /** Number of dots in a whole frame */
+    inline static constexpr long DOTS_PER_FRAME = 262 * DOTS_PER_SCANLINE;
+
     /**
     * Class constructor. Initializes a
     * class instance with given parameters.'
@@ -141,22 +153,48 @@ public:
     PPU2C02(std::function<void(void)> nmiCallback);
 
     /**
-    * Boots the PPU by assingning a bus and 
-    * window to it.
+    * Boots the PPU by assingning 
+    * a bus to it.
     * 
     * @param bus PPU bus to be connected
-    * @param window window for video output
     * 
     * @see PPUBus
-    * @see Window
     */
-    void boot(PPUBus& bus, Window* window);
+    void boot(PPUBus& bus);
 
     /**
     * Clocks the PPU
     */
     void clock(void);
 
+    /**
+    * Clocks the PPU through a whole
+    * scanline at once. Instead of 
+    * emulating it dot by dot, the
+    * scanline is rendered tile by tile
+    * and the sprites are drawn into
+    * a line buffer. The frame and the
+    * internal state end up exactly the
+    * same as after clocking each of the
+    * dots, as long as no register is
+    * accessed in the middle of the
+    * scanline. Has to be called at
+    * the start of a scanline.
+    * 
+    * @see isScanlineStart
+    */
+    void clockScanline(void);
+
+    /**
+    * Returns the information if 
+    * the PPU is about to start
+    * a new scanline.
+    * 
+    * @return true if the next dot
+    *   is the first dot of a scanline
+    */
+    bool isScanlineStart(void) const { return mCycle == -1; }
+
     /**
     * Reads data from a PPU register
     * under a given address.
@@ -217,8 +255,144 @@ public:
     */
     Byte getOamAddr(void) { return mRegisters[OAMADDR]; }
 
+    /**
+    * Returns the frame buffer. It holds
+    * FRAME_WIDTH x FRAME_HEIGHT pixels
+    * stored row by row as packed
+    * RGBA values.
+    * 
+    * @return frame buffer
+    * 
+    * @see mFrameBuffer
+    * @see Colour::rgba
+    */
+    const uint32_t* getFrameBuffer(void) const { return mFrameBuffer; }
+
+    /**
+    * Returns the 64 bit hash of
+    * the frame buffer, computed
+    * when the last frame was 
+    * finished. Frames with equal
+    * pixels have equal hashes.
+    * 
+    * @return hash of the last 
+    *   finished frame
+    * 
+    * @see hashFrameBuffer
+    */
+    uint64_t getFrameHash(void) const { return mFrameHash; }
+
+    /**
+    * Returns the number of frames
+    * finished so far. A frame is
+    * finished when the PPU enters
+    * the vertical blank.
+    * 
+    * @return number of frames
+    * 
+    * @see mFrameCount
+    */
+    unsigned long getFrameCount(void) const { return mFrameCount; }
+
+    /**
+    * Returns the status register
+    * without the side effects of
+    * reading it through PPUSTATUS.
+    * 
+    * @return value of the status
+    *   register
+    * 
+    * @see STATUS_REGISTER
+    */
+    Byte getStatus(void) const { return mRegisters[PPUSTATUS]; }
+
+    /**
+    * Returns a 64 bit hash of the
+    * internal state: the registers,
+    * OAM, the VRAM addresses, the
+    * background and sprite latches
+    * and shifters and the position.
+    * It allows checking that both
+    * renderers leave the PPU in the
+    * same state. The sprite lists
+    * are only a cache of OAM, so they
+    * aren't part of it.
+    * 
+    * @return hash of the state
+    * 
+    * @see clockScanline
+    */
+    uint64_t getStateHash(void) const;
+
+    /**
+    * Returns the number of dots
+    * the PPU has to be clocked
+    * before it reaches the dot
+    * starting the vertical blank.
+    * 
+    * @return number of dots before
+    *   the vertical blank
+    */
+    unsigned long getDotsUntilVblank(void) const { return this->getDotsUntil(241, 0); }
+
+    /**
+    * Sets how often the frames are
+    * drawn. With an interval of N
+    * only every Nth frame is drawn
+    * into the frame buffer and the
+    * rest of them leave it unchanged.
+    * The skipped frames still update
+    * the registers, flags and the
+    * interrupt timing like the drawn
+    * ones.
+    * 
+    * @param interval number of frames
+    *   per drawn frame, 1 draws all
+    *   of them
+    * 
+    * @see mFrameSkip
+    */
+    void setFrameSkip(const unsigned int& interval) { mFrameSkip = interval ? interval : 1; }
+
+    /**
+    * Checks if the current frame
+    * isn't drawn.
+    * 
+    * @return true if the current 
+    *   frame is skipped
+    * 
+    * @see setFrameSkip
+    */
+    bool isFrameSkipped(void) const { return mSkipFrame; }
+
+    /**
+    * Returns the number of frames
+    * finished without being drawn.
+    * 
+    * @return number of skipped frames
+    * 
+    * @see setFrameSkip
+    */
+    unsigned long getSkippedFrames(void) const { return mSkippedFrames; }
+
 private:
 
+    /**
+    * Returns the number of dots
+    * the PPU has to be clocked
+    * before it reaches a given
+    * position on the screen.
+    * 
+    * @param scanline scanline of
+    *   the position
+    * @param cycle cycle of the 
+    *   position
+    * 
+    * @return number of dots before
+    *   the given position
+    */
+    unsigned long getDotsUntil(const short& scanline, const short& cycle) const;
+
     /**
     * Performs all operations
     * liked to rendering frames
@@ -234,6 +408,72 @@ private:
     */
     void draw(void);
     
+    /**
+    * Performs the part of draw()
+    * that has an effect on the dots
+    * outside of the visible frame,
+    * which is the sprite 0 hit check.
+    * 
+    * @see draw
+    */
+    void drawOffscreen(void);
+
+    /**
+    * Draws the sprites of the whole
+    * scanline into a line buffer and
+    * moves their shifters to the state
+    * they end up in after the visible
+    * dots. Each pixel of the buffer
+    * holds the colour index of the
+    * sprite pixel on its lower 5 bits
+    * and its priority on the MSB.
+    * Transparent pixels are 0.
+    * 
+    * @param pixels line buffer of 
+    *   FRAME_WIDTH pixels or nullptr
+    *   if only the sprite 0 hit and
+    *   the shifters are needed
+    */
+    void drawSpriteLine(Byte* pixels);
+
+    /**
+    * Shifts the background shifters
+    * by a given number of dots, if
+    * the background is rendered.
+    * 
+    * @param dots number of dots
+    */
+    void shiftBackground(const int& dots);
+
+    /**
+    * Loads the previously fetched
+    * background tile into the lower
+    * bytes of the background shifters.
+    */
+    void loadBackgroundShifters(void);
+
+    /**
+    * Fetches the next background
+    * tile and increments the X
+    * coordinate, just like the 8 
+    * dots of a tile fetch do.
+    * 
+    * @return decoded row of
+    *   the fetched tile
+    * 
+    * @see updateBackgroundData
+    */
+    const TileRow& fetchBackgroundTile(void);
+
+    /**
+    * Returns the pattern table
+    * address of the current row
+    * of the background tile.
+    * 
+    * @return pattern table address
+    */
+    Word getBgTileAddress(void) const;
+
     /**
     * Updates the x and y
     * coordinates on the 
@@ -305,13 +545,43 @@ private:
     */
     void updateShifters(void);
 
+    /**
+    * Hashes the frame buffer. The
+    * pixels are mixed into four 
+    * independent lanes, which lets
+    * the compiler vectorize the loop
+    * or at least overlap the lanes,
+    * and the lanes are folded into
+    * a single hash at the end.
+    * 
+    * @return hash of the frame buffer
+    * 
+    * @see mFrameHash
+    */
+    uint64_t hashFrameBuffer(void) const;
+
     /**
     * Evaluates OAM memory to
     * determine which sprites 
-    * should be rendered.
+    * should be rendered. The 
+    * sprites are read from the
+    * list of the current scanline.
+    * 
+    * @see buildSpriteLists
     */
     void evaluateOam(void);
 
+    /**
+    * Sorts the sprites in OAM into
+    * the lists of the scanlines they
+    * cover, at most 8 per scanline,
+    * and marks the scanlines that
+    * have more of them.
+    * 
+    * @see mScanlineSprites
+    */
+    void buildSpriteLists(void);
+
     /**
     * Checks if the scanline 
     * is rendering the first
@@ -333,7 +603,8 @@ private:
     /**
     * Performs a postrender
     * routine. VBLANK flag
-    * is set and if the VBNMIEN
+    * is set, the frame is marked
+    * as finished and if the VBNMIEN
     * flag is set the NMI callback
     * is called.
     */
@@ -371,22 +642,12 @@ private:
     */
     void resetY(void);
 
-    /**
-    * Lookup table for the
-    * colours supported by
-    * the NES' PPU
-    */
-    const ColourLUT mColours;
-
     /** Non-maskable interrupt callback */
     std::function<void(void)> mNmiCallback;
 
     /** Internal PPU bus */
     PPUBus* mBus;
 
-    /** Window for video output */
-    Window* mWindow;
-
     /** 
     * Registers available for 
     * outside reads and writes.
@@ -411,6 +672,27 @@ private:
     */
     Byte mSpriteCount;
 
+    /**
+    * OAM indices of the sprites
+    * evaluated on each scanline.
+    */
+    Byte mScanlineSprites[FRAME_HEIGHT][8];
+
+    /** 
+    * Number of sprites on each 
+    * scanline. 9 means that the
+    * scanline has more than 8 of
+    * them and overflows.
+    */
+    Byte mScanlineSpriteCount[FRAME_HEIGHT];
+
+    /** 
+    * Flag indicating that OAM or the
+    * sprite size changed since the
+    * sprite lists were built.
+    */
+    bool mSpriteListsDirty;
+
     /** 
     * Internal VRAM 
     * address pointer. 
@@ -528,6 +810,24 @@ private:
     
     /** Currently drawn column */
     short mCycle;           
+
+    /** Number of finished frames */
+    unsigned long mFrameCount;
+
+    /** Number of frames per drawn frame */
+    unsigned int mFrameSkip;
+
+    /** Flag indicating that the current frame isn't drawn */
+    bool mSkipFrame;
+
+    /** Number of finished frames that weren't drawn */
+    unsigned long mSkippedFrames;
+
+    /** Hash of the frame buffer after the last finished frame */
+    uint64_t mFrameHash;
+
+    /** Pixels of the visible part of the frame */
+    uint32_t mFrameBuffer[FRAME_WIDTH * FRAME_HEIGHT];
 };
 
 #endif // !PPU_H
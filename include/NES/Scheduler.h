@@ -0,0 +1,134 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <cstdint>
+
+/**
+* Events handled by the
+* scheduler. When several
+* events are due at the same
+* master cycle, they are
+* dispatched in the order
+* of this enum.
+*
+* @see Scheduler
+*/
+enum SchedulerEvent : uint8_t {
+    EVENT_NMI,      //vertical blank of the PPU, which may raise a non-maskable interrupt
+    EVENT_DMA,      //single cycle of an OAM DMA transfer
+    EVENT_APU,      //step of the APU frame sequencer
+    EVENT_CPU,      //execution of the next batch of CPU instructions
+    EVENT_COUNT
+};
+
+/**
+* Event scheduler of the emulator.
+* It keeps the time in master clock
+* cycles (PPU dots) on a 64 bit
+* counter, so it never wraps around.
+* Each event has a single slot
+* holding the master cycle at which
+* the event is due, which keeps the
+* queue tiny and allocation free.
+*
+* @see SchedulerEvent
+*/
+class Scheduler {
+public:
+
+    using Cycle = uint64_t;
+
+    /** Time of an event that is not scheduled */
+    inline static constexpr Cycle NEVER = UINT64_MAX;
+
+    /**
+    * Class constructor. Initializes
+    * an instance of the class with
+    * no scheduled events.
+    */
+    Scheduler(void) : mNow(0) {
+        for (int i = 0; i < EVENT_COUNT; ++i) { mEvents[i] = NEVER; }
+    }
+
+    /**
+    * Schedules an event at a given
+    * master cycle. If the event is
+    * already scheduled, it gets moved.
+    *
+    * @param event event to be scheduled
+    * @param time master cycle at which
+    *   the event is due
+    */
+    void schedule(const SchedulerEvent& event, const Cycle& time) { mEvents[event] = time; }
+
+    /**
+    * Removes an event from
+    * the queue.
+    *
+    * @param event event to be removed
+    */
+    void cancel(const SchedulerEvent& event) { mEvents[event] = NEVER; }
+
+    /**
+    * Returns the master cycle
+    * at which a given event is due.
+    *
+    * @param event queried event
+    *
+    * @return master cycle of the event
+    *   or NEVER if it isn't scheduled
+    */
+    Cycle getTime(const SchedulerEvent& event) const { return mEvents[event]; }
+
+    /**
+    * Returns the event that is due
+    * first. Ties are resolved in the
+    * order of the SchedulerEvent enum.
+    *
+    * @return next event
+    */
+    SchedulerEvent getNextEvent(void) const {
+        int next = 0;
+        for (int i = 1; i < EVENT_COUNT; ++i) {
+            if (mEvents[i] < mEvents[next]) { next = i; }
+        }
+        return (SchedulerEvent)next;
+    }
+
+    /**
+    * Marks a given event as being
+    * dispatched. The event gets
+    * removed from the queue and the
+    * current time is moved to its
+    * master cycle.
+    *
+    * @param event dispatched event
+    *
+    * @see mNow
+    */
+    void dispatch(const SchedulerEvent& event) {
+        mNow = mEvents[event];
+        mEvents[event] = NEVER;
+    }
+
+    /**
+    * Returns the master cycle of
+    * the last dispatched event.
+    *
+    * @return current master cycle
+    *
+    * @see mNow
+    */
+    Cycle getNow(void) const { return mNow; }
+
+private:
+
+    /** Master cycle of the last dispatched event */
+    Cycle mNow;
+
+    /** Master cycles at which the events are due */
+    Cycle mEvents[EVENT_COUNT];
+
+};
+
+#endif // !SCHEDULER_H
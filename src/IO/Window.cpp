@@ -1,164 +1,215 @@
 #include "IO/Window.h"
 
+#include <algorithm>
 #include <iostream>
 #include <cstdlib>
 #include <fstream>
 #include <thread>
+#include <stdexcept>
 
 #include "json/json.h"
 
 Window* Window::sInstance = nullptr;
 
-Window::Window(Joypad* joypads, const ScreenOptions& screenOptions, const AudioOptions& audioOptions) :
+Window::Window(const ScreenOptions& screenOptions, const AudioOptions& audioOptions) :
+    mFramesEmulated(0),
+    mFramesPresented(0),
+    mFramesDropped(0),
+    mFramesUnchanged(0),
+    mEmulationTime(0),
+    mPresentationTime(0),
+    mLatency(0),
+    mMaxLatency(0),
+    mAudioRing(audioOptions.sampleRate / 4),
+    mAudioUnderruns(0),
+    mAudioOverruns(0),
+    mAudioTarget(audioOptions.sampleRate * audioOptions.latency / 1000.0),
+    mAverageFill(mAudioTarget),
+    mSampleRateRatio(1.0),
+    mLastSample(0),
+    mAudioPrimed(false),
+    mJoypads{nullptr, nullptr},
+    mIsOpen(true),
+    mTextureHash(0),
+    mTextureLoaded(false),
     mScale (screenOptions.scale),
-    mAudioBufferSize(4096)
+    mAudioBufferSize(audioOptions.bufferSize)
 {
-    for(int i = 0; i < 2; ++i) {
-        mJoypads[i] = &joypads[i];
-        if (!mJoypads[i]) { 
-          throw std::runtime_error("Not enough joypads supplied to the Window");
-        }
-    }
-
+    SetConfigFlags(FLAG_VSYNC_HINT); //the presentation loop is paced by the emulated frames and the display
     InitWindow(screenOptions.width * mScale, screenOptions.height * mScale, screenOptions.title.c_str());
-    SetTargetFPS(60);
+
+    Image frame = GenImageColor(screenOptions.width, screenOptions.height, BLACK); //RGBA with 8 bits per channel
+    mFrameTexture = LoadTextureFromImage(frame);
+    UnloadImage(frame);
 
     InitAudioDevice();
     SetAudioStreamBufferSizeDefault(mAudioBufferSize);
     mAudioStream = LoadAudioStream(audioOptions.sampleRate, 16, 1);
+    SetAudioStreamCallback(mAudioStream, Window::audioStreamCallback);
+    PlayAudioStream(mAudioStream);
 
-    BeginDrawing();
-    ClearBackground(BLACK);
-
-    std::thread inputHandler(&Window::handleInputs, this);
-    inputHandler.detach();
+    this->loadKeyBindings();
+    mNextFrameTime = Clock::now();
+    mFrameStartTime = mNextFrameTime;
 }
 
 Window::~Window(void) { 
+    UnloadTexture(mFrameTexture);
     UnloadAudioStream(mAudioStream);
     CloseAudioDevice();
     CloseWindow(); 
 }
 
-Window* Window::getInstance(Joypad* joypads, const ScreenOptions& screenOptions, const AudioOptions& audioOptions) {
+Window* Window::getInstance(const ScreenOptions& screenOptions, const AudioOptions& audioOptions) {
     if (!sInstance)
-        sInstance = new Window(joypads, screenOptions, audioOptions);
+        sInstance = new Window(screenOptions, audioOptions);
     return sInstance;
 }
 
-void Window::audioStreamCallback(void* buffer, unsigned int frames) {
-    sInstance->mAudioStreamCallback(buffer, frames);
+void Window::connectJoypads(Joypad* joypads) {
+    for(int i = 0; i < 2; ++i) {
+        mJoypads[i] = &joypads[i];
+        if (!mJoypads[i]) { 
+          throw std::runtime_error("Not enough joypads supplied to the Window");
+        }
+    }
 }
 
-void Window::setAudioStreamCallback(std::function<void(void*, unsigned int)> audioStreamCallback) {
-    sInstance->mAudioStreamCallback = audioStreamCallback;
-    SetAudioStreamCallback(mAudioStream, Window::audioStreamCallback);
-}
+void Window::present(void) {
+    while (mIsOpen && !WindowShouldClose()) {
+        this->handleInputs();
 
-void Window::playAudioStream(void) {
-    PlayAudioStream(mAudioStream);
+        bool newFrame = mFrames.acquire();
+        if (!newFrame && mTextureLoaded) { //nothing new to draw yet
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            continue;
+        }
+        const PresentedFrame& frame = mFrames.getFront();
+        Clock::time_point start = Clock::now();
+        if (newFrame && mTextureLoaded && frame.hash == mTextureHash) { ++mFramesUnchanged; }
+        else if (newFrame) {
+            UpdateTexture(mFrameTexture, frame.pixels);
+            mTextureHash = frame.hash;
+            mTextureLoaded = true;
+        }
+        BeginDrawing();
+        ClearBackground(BLACK);
+        DrawTextureEx(mFrameTexture, {0, 0}, 0.0f, mScale, WHITE);
+        Clock::time_point drawn = Clock::now();
+        EndDrawing();   //waits for the next refresh
+
+        if (!newFrame) { continue; }
+        Clock::rep latency = (Clock::now() - frame.handedOver).count();
+        mPresentationTime += (drawn - start).count();
+        mLatency += latency;
+        if (latency > mMaxLatency) { mMaxLatency = latency; } //only this thread writes it
+        ++mFramesPresented;
+    }
+    mIsOpen = false;
 }
 
-void Window::swapBuffers(void) {
-    EndDrawing();
-    BeginDrawing();
-    ClearBackground(BLACK);
+FrameStats Window::getFrameStats(void) const {
+    auto milliseconds = [](const Clock::rep& total, const unsigned long& frames) {
+        return frames ? std::chrono::duration<double, std::milli>(Clock::duration(total)).count() / frames : 0.0;
+    };
+    FrameStats stats;
+    stats.framesEmulated = mFramesEmulated;
+    stats.framesPresented = mFramesPresented;
+    stats.framesDropped = mFramesDropped;
+    stats.framesUnchanged = mFramesUnchanged;
+    stats.emulationTime = milliseconds(mEmulationTime, stats.framesEmulated);
+    stats.presentationTime = milliseconds(mPresentationTime, stats.framesPresented);
+    stats.latency = milliseconds(mLatency, stats.framesPresented);
+    stats.maxLatency = milliseconds(mMaxLatency, 1);
+    return stats;
 }
 
-void Window::drawPixel(const int& posX, const int& posY, const Colour& colour) {
-    DrawRectangle(
-        posX * mScale, 
-        posY * mScale, 
-        mScale, 
-        mScale, 
-        {colour.red(), colour.green(), colour.blue(), 255}
-    );
+AudioStats Window::getAudioStats(void) const {
+    AudioStats stats;
+    stats.underruns = mAudioUnderruns;
+    stats.overruns = mAudioOverruns;
+    stats.queuedSamples = mAudioRing.getSize();
+    return stats;
 }
 
-void Window::handleInputs(void) {
-    uint16_t
-      p1UP = KEY_W,  p1DN = KEY_S,    p1LT = KEY_A,    p1RT = KEY_D,     p1SL = KEY_Y,    p1ST = KEY_T,    p1BA = KEY_G,    p1BB = KEY_H,
-      p2UP = KEY_UP, p2DN = KEY_DOWN, p2LT = KEY_LEFT, p2RT = KEY_RIGHT, p2SL = KEY_KP_6, p2ST = KEY_KP_5, p2BA = KEY_KP_2, p2BB = KEY_KP_3;
-
-    std::ifstream configFile(CONFIG_PATH, std::ifstream::binary);
-    if (!configFile.is_open()) { 
-        std::cout << "Failed to load keyboard configuration file. Switching to default key bindings.\n";
-    } else {
-        Json::Value root;
-        configFile >> root;
-
-        p1UP = root["KEY_CODES"][root["JOYPAD_1"]["UP"].asString()].asInt();
-        p1DN = root["KEY_CODES"][root["JOYPAD_1"]["DOWN"].asString()].asInt();
-        p1LT = root["KEY_CODES"][root["JOYPAD_1"]["LEFT"].asString()].asInt();
-        p1RT = root["KEY_CODES"][root["JOYPAD_1"]["RIGHT"].asString()].asInt();
-        p1SL = root["KEY_CODES"][root["JOYPAD_1"]["SELECT"].asString()].asInt();
-        p1ST = root["KEY_CODES"][root["JOYPAD_1"]["START"].asString()].asInt();
-        p1BA = root["KEY_CODES"][root["JOYPAD_1"]["A"].asString()].asInt();
-        p1BB = root["KEY_CODES"][root["JOYPAD_1"]["B"].asString()].asInt();
-
-        p2UP = root["KEY_CODES"][root["JOYPAD_2"]["UP"].asString()].asInt();
-        p2DN = root["KEY_CODES"][root["JOYPAD_2"]["DOWN"].asString()].asInt();
-        p2LT = root["KEY_CODES"][root["JOYPAD_2"]["LEFT"].asString()].asInt();
-        p2RT = root["KEY_CODES"][root["JOYPAD_2"]["RIGHT"].asString()].asInt();
-        p2SL = root["KEY_CODES"][root["JOYPAD_2"]["SELECT"].asString()].asInt();
-        p2ST = root["KEY_CODES"][root["JOYPAD_2"]["START"].asString()].asInt();
-        p2BA = root["KEY_CODES"][root["JOYPAD_2"]["A"].asString()].asInt();
-        p2BB = root["KEY_CODES"][root["JOYPAD_2"]["B"].asString()].asInt();
+void Window::audioStreamCallback(void* buffer, unsigned int frames) {
+    short* d = (short*)buffer;
+    if (!sInstance) { //the window is still being created
+        for (unsigned int i = 0; i < frames; ++i) { d[i] = 0; }
+        return;
     }
-    
-    while (!WindowShouldClose()) {
-
-
-        // PLAYER 1
-        if (IsKeyDown(p1UP)) { mJoypads[0]->setButtonState(Joypad::Button::BUTTON_UP, true); } 
-        else { mJoypads[0]->setButtonState(Joypad::Button::BUTTON_UP, false); }
-
-        if (IsKeyDown(p1DN)) {  mJoypads[0]->setButtonState(Joypad::Button::BUTTON_DOWN, true); } 
-        else { mJoypads[0]->setButtonState(Joypad::Button::BUTTON_DOWN, false); }
-
-        if (IsKeyDown(p1LT)) {  mJoypads[0]->setButtonState(Joypad::Button::BUTTON_LEFT, true); } 
-        else { mJoypads[0]->setButtonState(Joypad::Button::BUTTON_LEFT, false); }
-
-        if (IsKeyDown(p1RT)) {  mJoypads[0]->setButtonState(Joypad::Button::BUTTON_RIGHT, true); } 
-        else { mJoypads[0]->setButtonState(Joypad::Button::BUTTON_RIGHT, false); }
 
-        if (IsKeyDown(p1SL)) {  mJoypads[0]->setButtonState(Joypad::Button::BUTTON_SELECT, true); } 
-        else { mJoypads[0]->setButtonState(Joypad::Button::BUTTON_SELECT, false); }
-
-        if (IsKeyDown(p1ST)) {  mJoypads[0]->setButtonState(Joypad::Button::BUTTON_START, true); } 
-        else { mJoypads[0]->setButtonState(Joypad::Button::BUTTON_START, false); }
-
-        if (IsKeyDown(p1BA)) {  mJoypads[0]->setButtonState(Joypad::Button::BUTTON_A, true); } 
-        else { mJoypads[0]->setButtonState(Joypad::Button::BUTTON_A, false); }
-
-        if (IsKeyDown(p1BB)) {  mJoypads[0]->setButtonState(Joypad::Button::BUTTON_B, true); } 
-        else { mJoypads[0]->setButtonState(Joypad::Button::BUTTON_B, false); }
-
-
-        //PLAYER 2
-        if (IsKeyDown(p2UP)) { mJoypads[1]->setButtonState(Joypad::Button::BUTTON_UP, true); } 
-        else { mJoypads[1]->setButtonState(Joypad::Button::BUTTON_UP, false); }
-
-        if (IsKeyDown(p2DN)) {  mJoypads[1]->setButtonState(Joypad::Button::BUTTON_DOWN, true); } 
-        else { mJoypads[1]->setButtonState(Joypad::Button::BUTTON_DOWN, false); }
+    if (!sInstance->mAudioPrimed && sInstance->mAudioRing.getSize() < sInstance->mAudioTarget) {
+        std::fill(d, d + frames, sInstance->mLastSample);
+        return;
+    }
+    sInstance->mAudioPrimed = true;
+
+    size_t read = sInstance->mAudioRing.read(d, frames);
+    if (read) { sInstance->mLastSample = d[read - 1]; }
+    if (read == frames) { return; }
+    std::fill(d + read, d + frames, sInstance->mLastSample);
+    ++sInstance->mAudioUnderruns;
+    sInstance->mAudioPrimed = false;
+}
 
-        if (IsKeyDown(p2LT)) {  mJoypads[1]->setButtonState(Joypad::Button::BUTTON_LEFT, true); } 
-        else { mJoypads[1]->setButtonState(Joypad::Button::BUTTON_LEFT, false); }
+void Window::queueAudio(const int16_t* samples, const size_t& sampleCount) {
+    //the level is measured before the samples are added, when it's the lowest
+    mAverageFill += (mAudioRing.getSize() - mAverageFill) / FILL_SMOOTHING;
+    double deviation = std::clamp((mAudioTarget - mAverageFill) / mAudioTarget, -1.0, 1.0);
+    mSampleRateRatio = 1.0 + MAX_RATE_ADJUSTMENT * deviation;
 
-        if (IsKeyDown(p2RT)) {  mJoypads[1]->setButtonState(Joypad::Button::BUTTON_RIGHT, true); } 
-        else { mJoypads[1]->setButtonState(Joypad::Button::BUTTON_RIGHT, false); }
+    if (mAudioRing.write(samples, sampleCount) < sampleCount) { ++mAudioOverruns; }
+}
 
-        if (IsKeyDown(p2SL)) {  mJoypads[1]->setButtonState(Joypad::Button::BUTTON_SELECT, true); } 
-        else { mJoypads[1]->setButtonState(Joypad::Button::BUTTON_SELECT, false); }
+void Window::swapBuffers(const uint32_t* frameBuffer, const uint64_t& frameHash) {
+    Clock::time_point now = Clock::now();
+    mEmulationTime += (now - mFrameStartTime).count();
+
+    PresentedFrame& frame = mFrames.getBack();
+    std::copy(frameBuffer, frameBuffer + FRAME_PIXELS, frame.pixels);
+    frame.hash = frameHash;
+    frame.handedOver = now;
+    if (mFrames.publish()) { ++mFramesDropped; }
+    ++mFramesEmulated;
+
+    mNextFrameTime += FRAME_DURATION;
+    if (mNextFrameTime < now - 4 * FRAME_DURATION) { mNextFrameTime = now; } //too far behind to catch up
+    std::this_thread::sleep_until(mNextFrameTime);
+    mFrameStartTime = Clock::now();
+}
 
-        if (IsKeyDown(p2ST)) {  mJoypads[1]->setButtonState(Joypad::Button::BUTTON_START, true); } 
-        else { mJoypads[1]->setButtonState(Joypad::Button::BUTTON_START, false); }
+void Window::loadKeyBindings(void) {
+    const int defaults[2][8] = {
+        { KEY_G, KEY_H, KEY_Y, KEY_T, KEY_W, KEY_S, KEY_A, KEY_D },
+        { KEY_KP_2, KEY_KP_3, KEY_KP_6, KEY_KP_5, KEY_UP, KEY_DOWN, KEY_LEFT, KEY_RIGHT }
+    };
+    for (int joypad = 0; joypad < 2; ++joypad) {
+        for (int button = 0; button < 8; ++button) { mKeyBindings[joypad][button] = defaults[joypad][button]; }
+    }
 
-        if (IsKeyDown(p2BA)) {  mJoypads[1]->setButtonState(Joypad::Button::BUTTON_A, true); } 
-        else { mJoypads[1]->setButtonState(Joypad::Button::BUTTON_A, false); }
+    std::ifstream configFile(CONFIG_PATH, std::ifstream::binary);
+    if (!configFile.is_open()) { 
+        std::cout << "Failed to load keyboard configuration file. Switching to default key bindings.\n";
+        return;
+    }
 
-        if (IsKeyDown(p2BB)) {  mJoypads[1]->setButtonState(Joypad::Button::BUTTON_B, true); } 
-        else { mJoypads[1]->setButtonState(Joypad::Button::BUTTON_B, false); }
+    Json::Value root;
+    configFile >> root;
+    const char* joypadNames[2] = { "JOYPAD_1", "JOYPAD_2" };
+    const char* buttonNames[8] = { "A", "B", "SELECT", "START", "UP", "DOWN", "LEFT", "RIGHT" };
+    for (int joypad = 0; joypad < 2; ++joypad) {
+        for (int button = 0; button < 8; ++button) {
+            mKeyBindings[joypad][button] = root["KEY_CODES"][root[joypadNames[joypad]][buttonNames[button]].asString()].asInt();
+        }
+    }
+}
 
+void Window::handleInputs(void) {
+    for (int joypad = 0; joypad < 2; ++joypad) {
+        if (!mJoypads[joypad]) { continue; }
+        for (int button = 0; button < 8; ++button) {
+            mJoypads[joypad]->setButtonState((Joypad::Button)(1 << button), IsKeyDown(mKeyBindings[joypad][button]));
+        }
     }
 }
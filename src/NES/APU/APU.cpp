@@ -1,108 +1,67 @@
 #include "NES/APU/APU.h"
 
+#include <algorithm>
+
 using Byte = APU::Byte;
 using Word = APU::Word;
 
-APU::APU(Window* window, const unsigned int& sampleRate) :
-    mCycles(0),
+APU::APU(const unsigned int& sampleRate) :
     mMode(0),
-    mAudioBufferSize(window->getAudioBufferSize())
+    mFrameStep(0),
+    mSampleRate(sampleRate),
+    mTime(0),
+    mTimers{ 0, 0, 0, 0 },
+    mOutput(0),
+    mBlipBuffer(CPU_CLOCK_SPEED, sampleRate, MAX_FRAME_CYCLES)
 {
-    mAudioBuffer = new short[mAudioBufferSize];
-
-    if (sampleRate != APUOscillator::DEFAULT_SAMPLE_RATE) {
-        mPulse[0].setSampleRate(sampleRate);
-        mPulse[1].setSampleRate(sampleRate);
-        mTriangle.setSampleRate(sampleRate);
-        mNoise.setSampleRate(sampleRate);
-    }
+    mSamples.reserve(sampleRate / 30); //two frames worth of samples
+}
 
-    window->setAudioStreamCallback(
-        [this](void* buffer, unsigned int frames) {
-            this->update(buffer, frames);
-        }
-    );
-    window->playAudioStream();
+void APU::setSampleRateRatio(const double& ratio) {
+    double clamped = std::clamp(ratio, 1.0 - MAX_RATE_ADJUSTMENT, 1.0 + MAX_RATE_ADJUSTMENT);
+    mBlipBuffer.setSampleRate(mSampleRate * clamped);
 }
 
-APU::~APU(void) {
-    delete [] mAudioBuffer;
+void APU::run(const unsigned int& cycles) {
+    if (mTime + cycles > MAX_FRAME_CYCLES) { this->endFrame(); }
+    mTime += cycles;
 }
 
-void APU::clock(void) {
-    ++mCycles;
-    //mDMC.clock();
-    switch (mCycles) { //these are predefined cycles and their behaviour
-        case 3728:  //quarter frame
-            mPulse[0].updateVolume();
-            mPulse[1].updateVolume();
-            mTriangle.updateLinearCounter();
-            mNoise.updateVolume();
+void APU::clockFrameSequencer(void) {
+    this->runChannels(mTime);
+    bool fiveStepMode = mMode >> 7;
+    switch (mFrameStep) {
+        case 0:     //quarter frame
+        case 2:
+            this->quarterFrame();
             break;
-        case 7456:  //half frame
-            mPulse[0].updateVolume();
-            mPulse[0].updateLength();
-            mPulse[0].updateSweep();
-
-            mPulse[1].updateVolume();
-            mPulse[1].updateLength();
-            mPulse[1].updateSweep();
-
-            mTriangle.updateLinearCounter();
-            mTriangle.updateLength();
-
-            mNoise.updateVolume();
-            mNoise.updateLength();
+        case 3:     //half frame, in 5 step mode executed quarter frame later
+            if (!fiveStepMode) { this->halfFrame(); }
             break;
-        case 11185: //quarter frame
-            mPulse[0].updateVolume();
-
-            mPulse[1].updateVolume();
-
-            mTriangle.updateLinearCounter();
-
-            mNoise.updateVolume();
+        default:    //half frame
+            this->halfFrame();
             break;
-        case 14914: //half frame
-            if (mMode >> 7) { return; } //if in 5 step mode, the rest is executed quarter frame later
-            mPulse[0].updateVolume();
-            mPulse[0].updateLength();
-            mPulse[0].updateSweep();
-
-            mPulse[1].updateVolume();
-            mPulse[1].updateLength();
-            mPulse[1].updateSweep();
-
-            mTriangle.updateLinearCounter();
-            mTriangle.updateLength();
-
-            mNoise.updateVolume();
-            mNoise.updateLength();
-            mCycles = 0;
-            break;
-        case 18640: //this is reached only in 5 step mode
-            mPulse[0].updateVolume();
-            mPulse[0].updateLength();
-            mPulse[0].updateSweep();
-
-            mPulse[1].updateVolume();
-            mPulse[1].updateLength();
-            mPulse[1].updateSweep();
+    }
+    this->updateOutput(mTime);
+    mFrameStep = mFrameStep + 1 < (fiveStepMode ? 5 : 4) ? mFrameStep + 1 : 0;
+}
 
-            mTriangle.updateLinearCounter();
-            mTriangle.updateLength();
+void APU::endFrame(void) {
+    this->runChannels(mTime);
+    mBlipBuffer.endFrame(mTime);
+    for (unsigned int& timer : mTimers) { timer -= mTime; }
+    mTime = 0;
 
-            mNoise.updateVolume();
-            mNoise.updateLength();
-            mCycles = 0;
-            break;
-        default: break;
-    }
+    size_t count = mBlipBuffer.getSamplesAvailable();
+    size_t offset = mSamples.size();
+    mSamples.resize(offset + count);
+    mBlipBuffer.readSamples(&mSamples[offset], count);
 }
 
 Byte APU::readRegister(const Word& address) { return 0; }
 
 void APU::writeRegister(const Byte& data, const Word& address) {
+    this->runChannels(mTime);
     switch (address) {
         case SQ1_VOL:   this->writePulseVolume(data, 0);    break;
         case SQ1_SWEEP: this->writePulseSweep(data, 0);     break;
@@ -119,20 +78,14 @@ void APU::writeRegister(const Byte& data, const Word& address) {
         case NOISE_LO:  this->writeNoiseLo(data);           break;
         case NOISE_HI:  this->writeNoiseHi(data);           break;
         //case DMC_FREQ:  mDMC.writeFlags(data);              break;
-        //case DMC_RAW:   mDMC.writeDirectLoad(data);         break;
+        case DMC_RAW:   mDMC.writeDirectLoad(data);         break;
         //case DMC_START: mDMC.writeSampleLength(data);       break;
         //case DMC_LEN:   mDMC.writeSampleLength(data);       break;
         case STATUS:    this->updateStatus(data);           break;
         case FRAME_COUNTER:     mMode = data;               break;
         default:                                            break;
     }
-}
-
-void APU::update(void* buffer, unsigned int frames) {
-    short* d = (short*)buffer;
-    for (unsigned int i = 0; i < frames; ++i) {
-        d[i] = (short)(32000.0f * this->getSample());
-    }
+    this->updateOutput(mTime);
 }
 
 void APU::writePulseVolume(const Byte& data, const Byte& oscIdx) {
@@ -182,9 +135,7 @@ void APU::writeNoiseVolume(const Byte& data) {
 
 void APU::writeNoiseLo(const Byte& data) {
     mNoise.setModeFlag(data & (1 << 7));
-    Word freq = mOscLUT.getNoiseFrequency(data & 0x0F);
-    mNoise.setFrequency(freq, false);
-    mNoise.setFrequency((freq >> 8) & 0x7, true);
+    mNoise.setPeriod(mOscLUT.getNoiseFrequency(data & 0x0F));
 }
 
 void APU::writeNoiseHi(const Byte& data) {
@@ -198,12 +149,50 @@ void APU::updateStatus(const Byte& data) {
     mNoise.setEnabled(data & (1 << 3));
 }
 
-float APU::getSample(void) {
-    float sample = 0;
-    sample += mPulse[0].process();
-    sample += mPulse[1].process();
-    sample += mTriangle.process();
-    sample += mNoise.process();
-    //sample += mDMC.process();
-    return sample / 4;
-}
\ No newline at end of file
+void APU::quarterFrame(void) {
+    mPulse[0].updateVolume();
+    mPulse[1].updateVolume();
+    mTriangle.updateLinearCounter();
+    mNoise.updateVolume();
+}
+
+void APU::halfFrame(void) {
+    this->quarterFrame();
+    for (APUPulse& pulse : mPulse) {
+        pulse.updateLength();
+        pulse.updateSweep();
+    }
+    mTriangle.updateLength();
+    mNoise.updateLength();
+}
+
+void APU::runChannels(const unsigned int& time) {
+    while (true) {
+        int channel = 0;
+        for (int i = 1; i < CHANNEL_COUNT; ++i) {
+            if (mTimers[i] < mTimers[channel]) { channel = i; }
+        }
+        unsigned int expiration = mTimers[channel];
+        if (expiration > time) { return; }
+        switch (channel) {
+            case 0:     mTimers[0] += mPulse[0].step();     break;
+            case 1:     mTimers[1] += mPulse[1].step();     break;
+            case 2:     mTimers[2] += mTriangle.step();     break;
+            default:    mTimers[3] += mNoise.step();        break;
+        }
+        this->updateOutput(expiration);
+    }
+}
+
+void APU::updateOutput(const unsigned int& time) {
+    int output = this->mix();
+    if (output == mOutput) { return; }
+    mBlipBuffer.addDelta(time, output - mOutput);
+    mOutput = output;
+}
+
+int APU::mix(void) const {
+    int pulse = mPulse[0].getLevel() + mPulse[1].getLevel();
+    int tnd = 3 * mTriangle.getLevel() + 2 * mNoise.getLevel() + mDMC.getLevel();
+    return PULSE_TABLE[pulse] + TND_TABLE[tnd];
+}
@@ -0,0 +1,79 @@
+#include "NES/APU/BlipBuffer.h"
+
+#include <algorithm>
+#include <cmath>
+
+BlipBuffer::BlipBuffer(const double& clockRate, const double& sampleRate, const unsigned int& maxFrameClocks) :
+    mClockRate(clockRate),
+    mMaxFrameClocks(maxFrameClocks),
+    mOffset(0),
+    mIntegrator(0)
+{
+    this->setSampleRate(sampleRate);
+
+    //every tap is the part of a windowed sinc falling between two samples, so the
+    //taps sum up to a band-limited step, which gets rebuilt when the samples are read
+    const double pi = 3.14159265358979323846;
+    const int half = KERNEL_WIDTH / 2;
+    const int steps = 32;
+    auto impulse = [&](const double& x) {
+        if (x <= -half || x >= half) { return 0.0; }
+        double sinc = x == 0.0 ? 2.0 * CUTOFF : std::sin(2.0 * pi * CUTOFF * x) / (pi * x);
+        double window = 0.42 + 0.5 * std::cos(pi * x / half) + 0.08 * std::cos(2.0 * pi * x / half);
+        return sinc * window;
+    };
+
+    for (int phase = 0; phase < PHASES; ++phase) {
+        double taps[KERNEL_WIDTH];
+        double total = 0.0;
+        for (int i = 0; i < KERNEL_WIDTH; ++i) {
+            double start = i - 1 - half - (double)phase / PHASES;
+            double area = 0.0;
+            for (int j = 0; j < steps; ++j) { area += impulse(start + (j + 0.5) / steps); }
+            taps[i] = area / steps;
+            total += taps[i];
+        }
+
+        int sum = 0;
+        int largest = 0;
+        for (int i = 0; i < KERNEL_WIDTH; ++i) {
+            mKernel[phase][i] = (int16_t)std::lround(taps[i] / total * (1 << KERNEL_BITS));
+            sum += mKernel[phase][i];
+            if (mKernel[phase][i] > mKernel[phase][largest]) { largest = i; }
+        }
+        mKernel[phase][largest] += (1 << KERNEL_BITS) - sum; //the steps have to be exact, or the integrator drifts
+    }
+}
+
+void BlipBuffer::setSampleRate(const double& sampleRate) {
+    mFactor = (uint64_t)std::llround(sampleRate / mClockRate * 4294967296.0);
+    size_t maxFrameSamples = (size_t)std::ceil(mMaxFrameClocks * sampleRate / mClockRate);
+    if (mBuffer.size() < maxFrameSamples + 1 + KERNEL_WIDTH) { mBuffer.resize(maxFrameSamples + 1 + KERNEL_WIDTH, 0); }
+}
+
+void BlipBuffer::addDelta(const unsigned int& time, const int& delta) {
+    uint64_t position = mOffset + time * mFactor;
+    const int16_t* kernel = mKernel[(position >> (FRAC_BITS - PHASE_BITS)) & (PHASES - 1)];
+    int32_t* out = &mBuffer[position >> FRAC_BITS];
+    for (int i = 0; i < KERNEL_WIDTH; ++i) { out[i] += kernel[i] * delta; }
+}
+
+void BlipBuffer::endFrame(const unsigned int& time) {
+    mOffset += time * mFactor;
+}
+
+void BlipBuffer::readSamples(int16_t* samples, const size_t& count) {
+    int32_t sum = mIntegrator;
+    for (size_t i = 0; i < count; ++i) {
+        sum += mBuffer[i];
+        int32_t sample = std::clamp(sum >> KERNEL_BITS, (int32_t)INT16_MIN, (int32_t)INT16_MAX);
+        samples[i] = (int16_t)sample;
+        sum -= sample * (1 << (KERNEL_BITS - BASS_SHIFT)); //high-pass, slowly pulling the signal back to 0
+    }
+    mIntegrator = sum;
+
+    size_t remaining = this->getSamplesAvailable() - count + KERNEL_WIDTH;
+    std::copy(mBuffer.begin() + count, mBuffer.begin() + count + remaining, mBuffer.begin());
+    std::fill(mBuffer.begin() + remaining, mBuffer.begin() + count + remaining, 0);
+    mOffset -= (uint64_t)count << FRAC_BITS;
+}
@@ -1,5 +1,7 @@
 #include "NES/APU/Oscillator.h"
 
+using Byte = APUOscillator::Byte;
+
 /******************/
 /* APU OSCILLATOR */
 /******************/
@@ -12,9 +14,7 @@ APUOscillator::APUOscillator(void) :
     mNoteLength(0),
     mInitialAmplitude(DEFAULT_AMPLITUDE),
     mCurrentAmplitude(DEFAULT_AMPLITUDE),
-    mFrequency(DEFAULT_FREQUENCY),
-    mRealAmplitude(0.0f),
-    mSampleRate(DEFAULT_SAMPLE_RATE)
+    mFrequency(DEFAULT_FREQUENCY)
 {}
 
 void APUOscillator::setEnabled(const bool& enabled) {
@@ -37,7 +37,6 @@ void APUOscillator::setAmplitude(const Byte& amplitude) {
     mInitialAmplitude   = amplitude;
     mCurrentAmplitude   = mHasConstantVolume ? amplitude : MAX_AMPLITUDE;
     mDivider            = amplitude;
-    mRealAmplitude      = mCurrentAmplitude / MAX_AMPLITUDE;
 }
 
 void APUOscillator::setFrequency(const Byte& frequency, const bool& highByteWrite) {
@@ -46,11 +45,6 @@ void APUOscillator::setFrequency(const Byte& frequency, const bool& highByteWrit
         : (mFrequency & 0xFF00) | frequency;
 }
 
-void APUOscillator::setSampleRate(const unsigned int& sampleRate) {
-    if (sampleRate == 0) { return; }
-    mSampleRate = sampleRate;
-}
-
 void APUOscillator::updateLength(void) {
     if (!mNoteLength || mIsLooping) { return; }
     else if (!mIsEnabled || --mNoteLength == 0) {
@@ -69,14 +63,9 @@ void APUOscillator::updateVolume(void) {
                 this->setEnabled(false);
             }
         }
-        mRealAmplitude = mCurrentAmplitude / MAX_AMPLITUDE;
     }
 }
 
-float APUOscillator::process(void) {
-    return 0.0f;
-}
-
 
 /*************/
 /* APU NOISE */
@@ -86,33 +75,18 @@ float APUOscillator::process(void) {
 APUNoise::APUNoise(void) :
     APUOscillator::APUOscillator(),
     mMode(false),
-    mLFSR(1),
-    mAngle(0.0f)
-{
-    mOffset = CPU_CLOCK_SPEED / mSampleRate;
-}
-
-void APUNoise::setSampleRate(const unsigned int& sampleRate) {
-    APUOscillator::setSampleRate(sampleRate);
-    mOffset = CPU_CLOCK_SPEED / mSampleRate;
-}
+    mLFSR(1)
+{}
 
-void APUNoise::updateRegister(void) {
-    mAngle += mOffset;
-    if (mAngle < mFrequency) { return; }
-    mAngle = 0.0f;
-    Byte MSB = 0;
-    Byte LSB = mLFSR & 0x1;
-    mLFSR >>= 1;
-    if (mMode) { MSB = LSB ^ (mLFSR & (1 << 4)); } 
-    else { MSB = LSB ^ (mLFSR & 0x1); }
-    mLFSR = mLFSR | (MSB << 14);
+unsigned int APUNoise::step(void) {
+    Byte feedback = (mLFSR ^ (mLFSR >> (mMode ? 6 : 1))) & 0x1;
+    mLFSR = (mLFSR >> 1) | (feedback << 14);
+    return mFrequency;
 }
 
-float APUNoise::process(void) {
-    if (!mIsEnabled) { return 0.0f; }
-    this->updateRegister();
-    return mRealAmplitude * (mLFSR & 0x1);
+Byte APUNoise::getLevel(void) const {
+    if (!mIsEnabled || (mLFSR & 0x1)) { return 0; }
+    return mCurrentAmplitude;
 }
 
 
@@ -126,11 +100,8 @@ APUTri::APUTri(void) :
     mReloadFlag(false),
     mLinearReload(0),
     mLinearCounter(0),
-    mAngle(0.0f)
-{
-    mRealFrequency = (CPU_CLOCK_SPEED / 2) / ((mFrequency + 1) << 4);
-    mOffset = mRealFrequency * NUM_OUTPUT_VALUES / mSampleRate;
-}
+    mSequenceStep(0)
+{}
 
 void APUTri::setLinearCounter(const Byte& counterValue) {
     mLinearCounter  = counterValue;
@@ -163,23 +134,15 @@ void APUTri::updateLinearCounter(void) {
         this->setAmplitude(0);
 }
 
-void APUTri::setFrequency(const Byte& frequency, const bool& highByteWrite) {
-    APUOscillator::setFrequency(frequency, highByteWrite);
-    mRealFrequency = (CPU_CLOCK_SPEED / 2) / ((mFrequency + 1) << 4);
-    mOffset = mRealFrequency * NUM_OUTPUT_VALUES / mSampleRate;
-}
-
-void APUTri::setSampleRate(const unsigned int& sampleRate) {
-    APUOscillator::setSampleRate(sampleRate);
-    mOffset = mRealFrequency * NUM_OUTPUT_VALUES / mSampleRate;
+unsigned int APUTri::step(void) {
+    if (mFrequency < 2) { return ULTRASONIC_POLL; } //these periods would only produce a DC offset
+    mSequenceStep = (mSequenceStep + 1) % NUM_OUTPUT_VALUES;
+    return mFrequency + 1;
 }
 
-float APUTri::process(void) {
-    if (!mIsEnabled) { return 0.0f; }
-    mAngle += mOffset;
-    mAngle -= mAngle >= 32.0f ? 32.0f : 0.0f;
-    Byte idx = mAngle;
-    return mRealAmplitude * OUTPUT_VALUES[idx & 0x1F] / MAX_OUTPUT_VALUE;
+Byte APUTri::getLevel(void) const {
+    if (!mIsEnabled) { return 0; }
+    return OUTPUT_VALUES[mSequenceStep] * mCurrentAmplitude / (Byte)MAX_AMPLITUDE;
 }
 
 
@@ -196,26 +159,12 @@ APUPulse::APUPulse(void) :
     mSweepShift(0),
     mSweepClock(0),
     mDutyCycle(DEFAULT_DUTY_CYCLE),
-    mAngle(0.0f)
-{
-    mRealFrequency = CPU_CLOCK_SPEED / ((mFrequency + 1) << 4);
-    mOffset = mRealFrequency / mSampleRate;
-}
-
-void APUPulse::setDutyCycle(const float& dutyCycle) {
-    if (dutyCycle < 0.0f || dutyCycle > 1.0f) { return; }
-    mDutyCycle = dutyCycle;
-}
+    mSequenceStep(0)
+{}
 
 void APUPulse::setFrequency(const Byte& frequency, const bool& highByteWrite) {
     APUOscillator::setFrequency(frequency, highByteWrite);
-    mRealFrequency = CPU_CLOCK_SPEED / ((mFrequency + 1) << 4);
-    mOffset = mRealFrequency / mSampleRate;
-}
-
-void APUPulse::setSampleRate(const unsigned int& sampleRate) {
-    APUOscillator::setSampleRate(sampleRate);
-    mOffset = mRealFrequency / mSampleRate;
+    if (highByteWrite) { mSequenceStep = 0; } //writing the high byte restarts the sequence
 }
 
 void APUPulse::setSweepPeriod(const Byte& period) {
@@ -235,13 +184,14 @@ void APUPulse::updateSweep(void) {
 
     Byte freqChange = mFrequency >> mSweepShift;
     mFrequency = mSweepDown ? mFrequency - freqChange : mFrequency + freqChange;
-    mRealFrequency = CPU_CLOCK_SPEED / ((mFrequency + 1) << 4);
-    mOffset = mRealFrequency / mSampleRate;
 }
 
-float APUPulse::process(void) {
-    if (!mIsEnabled) { return 0.0f; }
-    mAngle += mOffset;
-    mAngle -= mAngle > 1.0f ? 1.0f : 0.0f;
-    return mAngle < mDutyCycle ? mRealAmplitude * -1.0f : mRealAmplitude;
+unsigned int APUPulse::step(void) {
+    mSequenceStep = (mSequenceStep + 1) & 0x7;
+    return (mFrequency + 1) * 2; //the pulse timer is clocked every other CPU cycle
+}
+
+Byte APUPulse::getLevel(void) const {
+    if (!mIsEnabled || mFrequency < 8 || mFrequency > 0x7FF) { return 0; }
+    return (mDutyCycle >> mSequenceStep) & 0x1 ? mCurrentAmplitude : 0;
 }
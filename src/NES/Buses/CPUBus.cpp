@@ -8,14 +8,18 @@
 using Byte = CPUBus::Byte;
 using Word = CPUBus::Word;
 
-CPUBus::CPUBus(MOS6502& cpu, PPU2C02& ppu, APU& apu, Cartridge& cartridge, Joypad* joypads, Word& globalClock) : 
+CPUBus::CPUBus(MOS6502& cpu, PPU2C02& ppu, APU& apu, Cartridge& cartridge, Joypad* joypads, 
+    const Scheduler& scheduler, std::function<void(void)> ppuSyncCallback,
+    std::function<void(void)> apuSyncCallback) : 
     mCpu(&cpu),
     mPpu(&ppu), 
     mApu(&apu),
     mCartridge(&cartridge), 
     mDmaWait(false),
     mDmaData(0),
-    mGlobalClock(&globalClock)
+    mScheduler(&scheduler),
+    mPpuSyncCallback(ppuSyncCallback),
+    mApuSyncCallback(apuSyncCallback)
 {
     for(int i = 0; i < 2; ++i) {
         mJoypads[i] = &joypads[i];
@@ -24,11 +28,31 @@ CPUBus::CPUBus(MOS6502& cpu, PPU2C02& ppu, APU& apu, Cartridge& cartridge, Joypa
         }
     }
     memset(mRam, 0, 2048); 
+
+    for (int page = 0; page < 256; ++page) {
+        mReadPages[page] = nullptr;
+        mWritePages[page] = nullptr;
+    }
+    for (int page = 0; page < 0x20; ++page) {   //2KB of RAM mirrored up to 0x2000
+        mReadPages[page] = &mRam[(page & 0x7) << 8];
+        mWritePages[page] = &mRam[(page & 0x7) << 8];
+    }
+    this->mapPrgRomPages();
+    mCartridge->setBankSwitchCallback([this]() { this->mapPrgRomPages(); });
+}
+
+void CPUBus::mapPrgRomPages(void) {
+    //page 0x40 is shared with the APU and joypad registers, so it stays with the handlers
+    for (int page = 0x41; page < 256; ++page) { mReadPages[page] = mCartridge->getPrgRomPage(page); }
+    mCpu->invalidateInstructionCache(); //the decoded instructions belong to the previous banks
 }
 
-Byte CPUBus::read(const Word& address) {
+Byte CPUBus::readRegister(const Word& address) {
     if (address < 0x2000) { return mRam[address & 0x7FF]; } 
-    if (address < 0x4000) { return mPpu->readRegister(address); }
+    if (address < 0x4000) { 
+        mPpuSyncCallback();
+        return mPpu->readRegister(address); 
+    }
     if (address < 0x4020) {
         switch (address) {
           case 0x4016: return mJoypads[0]->read();
@@ -38,36 +62,50 @@ Byte CPUBus::read(const Word& address) {
     } else { return mCartridge->readPrgRom(address); }
 }
 
-void CPUBus::write(const Byte& data, const Word& address) {
+void CPUBus::writeRegister(const Byte& data, const Word& address) {
     if (address < 0x2000) { mRam[address & 0x7FF] = data; } 
-    else if (address < 0x4000) { mPpu->writeRegister(data, address); } 
-    else if (address < 0x4014) { mApu->writeRegister(data, address); }
+    else if (address < 0x4000) { 
+        mPpuSyncCallback();
+        mPpu->writeRegister(data, address); 
+    } 
+    else if (address < 0x4014) { 
+        mApuSyncCallback();
+        mApu->writeRegister(data, address); 
+    }
     else if (address == 0x4014) { //OAM DMA
+        mPpuSyncCallback();
         mPpu->startDmaTransfer(data);
         mCpu->startDmaTransfer();
         mDmaWait = true;
     }
     else if (address < 0x4018) { //joypads and APU
         switch (address) {
-            case 0x4015: mApu->writeRegister(data, address); break;
+            case 0x4015: 
+              mApuSyncCallback();
+              mApu->writeRegister(data, address); 
+              break;
             case 0x4016: 
               mJoypads[0]->setStrobe(data == 0x1);
               mJoypads[1]->setStrobe(data == 0x1); 
               break;
-            case 0x4017: mApu->writeRegister(data, address); break;
+            case 0x4017: 
+              mApuSyncCallback();
+              mApu->writeRegister(data, address); 
+              break;
             default: break;
         }
     } else { throw std::runtime_error("CPU tried to write into ROM memory\n"); }
 }
 
 void CPUBus::dmaTransfer(void) {
+    mPpuSyncCallback();
     if (mDmaWait) { //wait at the start to sync everything
-        if (*mGlobalClock % 2)
+        if (mScheduler->getNow() % 2)
             mDmaWait = false;
         return;
     }
 
-    if (*mGlobalClock % 2 == 0) {           //fetch data on even cycles
+    if (mScheduler->getNow() % 2 == 0) {    //fetch data on even cycles
         Word ramAddr = mPpu->getOamDma() << 8 | mPpu->getOamAddr();
         mDmaData = mRam[ramAddr & 0x7FF];
         return;
@@ -1,6 +1,7 @@
 #include "NES/Buses/PPUBus.h"
 
 #include <cstdlib>
+#include <cstring>
 
 #include "NES/Cartridge/Cartridge.h"
 
@@ -8,11 +9,62 @@ using Byte = PPUBus::Byte;
 using Word = PPUBus::Word;
 
 PPUBus::PPUBus(Cartridge& cartridge) : 
-    mCartridge(&cartridge) 
+    mCartridge(&cartridge),
+    mGrayscaleMask(0x3F),
+    mEmphasis(0)
 {
     memset(mNametable[0], 0, 1024);
     memset(mNametable[1], 0, 1024);
     memset(mPalette, 0, 32);
+    for (int index = 0; index < 32; ++index) { this->resolvePaletteColour(index); }
+    this->mapChrPages();
+    mCartridge->setChrBankSwitchCallback([this]() { this->mapChrPages(); });
+    this->mapNametables();
+    mCartridge->setMirroringCallback([this]() { this->mapNametables(); });
+}
+
+void PPUBus::mapNametables(void) {
+    Byte* a = mNametable[0];
+    Byte* b = mNametable[1];
+    Byte* cartridgeRam = mCartridge->getNametableRam();
+    switch (mCartridge->getMirroringType()) {
+        case HORIZONTAL:
+            mNametableSlots[0] = a; mNametableSlots[1] = a;
+            mNametableSlots[2] = b; mNametableSlots[3] = b;
+            break;
+        case SINGLE_SCREEN_A:
+            mNametableSlots[0] = a; mNametableSlots[1] = a;
+            mNametableSlots[2] = a; mNametableSlots[3] = a;
+            break;
+        case SINGLE_SCREEN_B:
+            mNametableSlots[0] = b; mNametableSlots[1] = b;
+            mNametableSlots[2] = b; mNametableSlots[3] = b;
+            break;
+        case ALTERNATIVE:
+            if (cartridgeRam) {
+                mNametableSlots[0] = a; mNametableSlots[1] = b;
+                mNametableSlots[2] = cartridgeRam; mNametableSlots[3] = cartridgeRam + 1024;
+                break;
+            }
+            [[fallthrough]];    //without the cartridge VRAM only two nametables exist
+        case VERTICAL:
+        default:
+            mNametableSlots[0] = a; mNametableSlots[1] = b;
+            mNametableSlots[2] = a; mNametableSlots[3] = b;
+            break;
+    }
+}
+
+void PPUBus::setColourMode(const bool& grayscale, const Byte& emphasis) {
+    Byte grayscaleMask = grayscale ? 0x30 : 0x3F;
+    if (grayscaleMask == mGrayscaleMask && emphasis == mEmphasis) { return; }
+    mGrayscaleMask = grayscaleMask;
+    mEmphasis = emphasis;
+    for (int index = 0; index < 32; ++index) { this->resolvePaletteColour(index); }
+}
+
+void PPUBus::mapChrPages(void) {
+    for (int page = 0; page < 8; ++page) { mTilePages[page] = mCartridge->getChrTilePage(page); }
 }
 
 Byte PPUBus::read(Word address) {
@@ -20,27 +72,7 @@ Byte PPUBus::read(Word address) {
     if (address < 0x2000) {
         return mCartridge->readChrRom(address);
     } else if (address < 0x3F00) {
-        address &= 0xFFF;
-        switch (mCartridge->getMirroringType()) {
-            case HORIZONTAL:
-                if (address >= 0x000 && address <= 0x3FF
-                    || address >= 0x400 && address <= 0x7FF )
-                    return mNametable[0][address & 0x3FF];
-                if (address >= 0x800 && address <= 0xBFF
-                    || address >= 0xC00 && address <= 0xFFF)
-                    return mNametable[1][address & 0x3FF];
-                return 0;
-            case VERTICAL:
-                if (address >= 0x000 && address <= 0x3FF
-                    || address >= 0x800 && address <= 0xBFF)
-                    return mNametable[0][address & 0x3FF];
-                if (address >= 0x400 && address <= 0x7FF
-                    || address >= 0xC00 && address <= 0xFFF)
-                    return mNametable[1][address & 0x3FF];
-                return 0;
-            default:
-                return 0;
-        }
+        return mNametableSlots[(address >> 10) & 0x3][address & 0x3FF];
     } else {
         address &= 0x1F;
         if (address == 0x10) { address = 0x00; }
@@ -54,29 +86,9 @@ Byte PPUBus::read(Word address) {
 void PPUBus::write(const Byte& data, Word address) {
     address &= 0x3FFF;
     if (address < 0x2000) {
-        /* DO NOTHING */
+        mCartridge->writeChrRam(data, address);
     } else if (address < 0x3F00) {
-        address &= 0xFFF;
-        switch (mCartridge->getMirroringType()) {
-            case HORIZONTAL:
-                if (address >= 0x000 && address <= 0x3FF
-                    || address >= 0x400 && address <= 0x7FF )
-                    mNametable[0][address & 0x3FF] = data;
-                if (address >= 0x800 && address <= 0xBFF
-                    || address >= 0xC00 && address <= 0xFFF)
-                    mNametable[1][address & 0x3FF] = data;
-                break;
-            case VERTICAL:
-                if (address >= 0x000 && address <= 0x3FF
-                    || address >= 0x800 && address <= 0xBFF)
-                    mNametable[0][address & 0x3FF] = data;
-                if (address >= 0x400 && address <= 0x7FF
-                    || address >= 0xC00 && address <= 0xFFF)
-                    mNametable[1][address & 0x3FF] = data;
-                break;
-            case ALTERNATIVE:
-                return;
-        }
+        mNametableSlots[(address >> 10) & 0x3][address & 0x3FF] = data;
     } else {
         address &= 0x1F;
         if (address == 0x10) { address = 0x00; }
@@ -84,5 +96,7 @@ void PPUBus::write(const Byte& data, Word address) {
         if (address == 0x18) { address = 0x08; }
         if (address == 0x1C) { address = 0x0C; }
         mPalette[address] = data;
+        this->resolvePaletteColour(address);
+        if (!(address & 0x3)) { this->resolvePaletteColour(address | 0x10); }
     }   
 }
\ No newline at end of file
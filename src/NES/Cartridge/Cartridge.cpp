@@ -29,6 +29,8 @@ Cartridge::Cartridge(const std::string& filePath) {
     //get data section size
     mPrgRom.resize(romFile.get() * 16384);  //size is given in 16KB units
     mChrRom.resize(romFile.get() * 8192);   //size is given in 8KB
+    mChrRam = mChrRom.empty();
+    if (mChrRam) { mChrRom.assign(8192, 0); } //cartridges without CHR ROM come with 8KB of CHR RAM
 
     //get additional info about the ROM file
     Byte ctrl1 = romFile.get();
@@ -40,6 +42,7 @@ Cartridge::Cartridge(const std::string& filePath) {
     if (ctrl1 & 1 << 3) { mMirroring = Mirroring::ALTERNATIVE; }
     else if (ctrl1 & 1) { mMirroring = Mirroring::VERTICAL; }
     else { mMirroring = Mirroring::HORIZONTAL; }
+    if (mMirroring == Mirroring::ALTERNATIVE) { mNametableRam.assign(2048, 0); }
 
     Byte mapperId = (ctrl2 & 0b11110000) | ctrl1 >> 4;
     switch (mapperId) {
@@ -55,7 +58,21 @@ Cartridge::Cartridge(const std::string& filePath) {
     Byte dataStart = hasTrainer ? 16 : 16 + 512; //skipping the trainer section
     romFile.seekg(dataStart, romFile.beg);
     for (int i = 0; i < mPrgRom.size(); ++i) { mPrgRom[i] = romFile.get(); }
-    for (int i = 0; i < mChrRom.size(); ++i) { mChrRom[i] = romFile.get(); }
+    if (!mChrRam) { 
+        for (int i = 0; i < mChrRom.size(); ++i) { mChrRom[i] = romFile.get(); } 
+    }
+
+    mChrTiles.resize(mChrRom.size());   //16 rows for every 16 bytes of a tile
+    for (size_t i = 0; i < mChrRom.size(); ++i) { 
+        if (!(i & 0x8)) { this->decodeChrRow(i); } //a row per every byte of the low bitplane
+    }
+}
+
+void Cartridge::setMirroringCallback(std::function<void(void)> callback) {
+    mMapper->setMirroringCallback([this, callback](Mirroring mirroring) {
+        mMirroring = mirroring;
+        callback();
+    });
 }
 
 Byte Cartridge::readPrgRom(const Word& address) {
@@ -63,7 +80,42 @@ Byte Cartridge::readPrgRom(const Word& address) {
     return 0;
 }
 
+const Byte* Cartridge::getPrgRomPage(const Byte& page) {
+    if (mPrgRom.size()) { return &mPrgRom[mMapper->mapPrgRomAddr(page << 8)]; }
+    return nullptr;
+}
+
 Byte Cartridge::readChrRom(const Word& address) {
     if (mChrRom.size()) { return mChrRom[mMapper->mapChrRomAddr(address)]; }
     return 0;
 }
+
+void Cartridge::writeChrRam(const Byte& data, const Word& address) {
+    if (!mChrRam) { return; }
+    size_t offset = mMapper->mapChrRomAddr(address);
+    mChrRom[offset] = data;
+    this->decodeChrRow(offset);
+}
+
+const TileRow* Cartridge::getChrTilePage(const Byte& page) {
+    return &mChrTiles[mMapper->mapChrRomAddr(page << 10)];
+}
+
+void Cartridge::decodeChrRow(const size_t& offset) {
+    size_t tile = offset & ~(size_t)0xF;
+    Byte row = offset & 0x7;
+    Byte lo = mChrRom[tile + row];
+    Byte hi = mChrRom[tile + row + 8];
+
+    TileRow& normal = mChrTiles[tile + row];
+    TileRow& flipped = mChrTiles[tile + 8 + row];
+    normal = TileRow{ { lo, hi }, 0 };
+    flipped = TileRow{ { 0, 0 }, 0 };
+    for (int x = 0; x < 8; ++x) {
+        Byte pixel = ((lo >> (7 - x)) & 1) | (((hi >> (7 - x)) & 1) << 1);
+        normal.pixels |= pixel << (14 - 2 * x);
+        flipped.pixels |= pixel << (2 * x);
+        flipped.planes[0] |= ((lo >> x) & 1) << (7 - x);
+        flipped.planes[1] |= ((hi >> x) & 1) << (7 - x);
+    }
+}
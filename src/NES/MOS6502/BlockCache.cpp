@@ -0,0 +1,43 @@
+#include "NES/MOS6502/BlockCache.h"
+
+#include "NES/MOS6502/OpcodeLUT.h"
+#include "NES/Buses/CPUBus.h"
+
+using Byte = BlockCache::Byte;
+using Word = BlockCache::Word;
+
+BlockCache::BlockCache(InstructionCache& instructionCache) : 
+	mInstructionCache(&instructionCache),
+	mBlocks(InstructionCache::END - InstructionCache::START + 1, CompiledBlock{ 0, 0, 0, 0 }),
+	mGeneration(1)	//blocks of generation 0 were never compiled
+{
+	mInstructions.reserve(0x4000);
+}
+
+void BlockCache::invalidate(void) {
+	mInstructions.clear();
+	if (++mGeneration) { return; }
+	for (CompiledBlock& block : mBlocks) { block.generation = 0; } //the counter wrapped around
+	mGeneration = 1;
+}
+
+void BlockCache::compile(CPUBus& bus, const Word& address, CompiledBlock& block) {
+	block.first = (uint32_t)mInstructions.size();
+	block.count = 0;
+	block.maxCycles = 0;
+
+	Word programCounter = address;
+	while (true) {
+		const CachedInstruction& instruction = mInstructionCache->fetch(bus, programCounter);
+		mInstructions.push_back(instruction);
+		++block.count;
+		//an instruction takes at most one more cycle for a page cross or a taken branch
+		block.maxCycles += instruction.cycles ? instruction.cycles + 1 : 256;
+
+		bool controlFlow = OpcodeLUT::getInfo(bus.read(programCounter)).controlFlow;
+		programCounter += instruction.length;
+		if (controlFlow || block.count == MAX_BLOCK_LENGTH) { break; }
+		if (!InstructionCache::isCached(programCounter)) { break; }
+	}
+	block.generation = mGeneration;
+}
@@ -0,0 +1,49 @@
+#include "NES/MOS6502/MOS6502.h"
+
+#ifdef NES_CPU_BLOCK_CORE
+
+#include "NES/MOS6502/OpcodeLUT.h"
+
+using Byte = MOS6502::Byte;
+
+/*
+* Alternative execution core of
+* the MOS6502 CPU. Code in the PRG
+* ROM is compiled into basic blocks
+* of decoded instructions, which are
+* executed one after another without
+* going back to the run loop. The cycle
+* budget is checked after every instruction
+* only if the block may not fit in it.
+* A store switching the PRG banks ends
+* the block, since the rest of it was
+* decoded from the old banks.
+* Code executed from other memory goes 
+* through the opcode lookup table.
+*/
+
+void MOS6502::executeInstruction(void) {
+	if (!BlockCache::isCached(mProgramCounter)) {
+		mCycles = 0;
+		Byte opcode = mBus->read(mProgramCounter++);
+		OpcodeLUT::getInstruction(opcode)(*this);
+		this->retireInstruction();
+		return;
+	}
+
+	const CompiledBlock& block = mBlockCache.fetch(*mBus, mProgramCounter);
+	const CachedInstruction* instruction = mBlockCache.getInstructions(block);
+	const CachedInstruction* end = instruction + block.count;
+	bool fitsBudget = mRunCycles + block.maxCycles < mRunBudget;
+	uint32_t generation = mBlockCache.getGeneration();
+	for (; instruction != end; ++instruction) {
+		mCycles = 0;
+		mProgramCounter += instruction->length;
+		instruction->execute(*this, instruction->operand);
+		this->retireInstruction();
+		if (mDmaTransferOn || (!fitsBudget && mRunCycles >= mRunBudget)) { return; }
+		if (mBlockCache.getGeneration() != generation) { return; }
+	}
+}
+
+#endif // NES_CPU_BLOCK_CORE
@@ -0,0 +1,33 @@
+#include "NES/MOS6502/MOS6502.h"
+
+#ifdef NES_CPU_CACHED_CORE
+
+#include "NES/MOS6502/OpcodeLUT.h"
+
+using Byte = MOS6502::Byte;
+
+/*
+* Alternative execution core of
+* the MOS6502 CPU. Instructions in
+* the PRG ROM are decoded once and
+* kept in the instruction cache, so 
+* the following executions skip the
+* opcode and operand fetch. Code
+* executed from other memory goes 
+* through the opcode lookup table.
+*/
+
+void MOS6502::executeInstruction(void) {
+	mCycles = 0;
+	if (InstructionCache::isCached(mProgramCounter)) {
+		const CachedInstruction& instruction = mInstructionCache.fetch(*mBus, mProgramCounter);
+		mProgramCounter += instruction.length;
+		instruction.execute(*this, instruction.operand);
+	} else {
+		Byte opcode = mBus->read(mProgramCounter++);
+		OpcodeLUT::getInstruction(opcode)(*this);
+	}
+	this->retireInstruction();
+}
+
+#endif // NES_CPU_CACHED_CORE
@@ -0,0 +1,32 @@
+#include "NES/MOS6502/InstructionCache.h"
+
+#include "NES/MOS6502/OpcodeLUT.h"
+#include "NES/Buses/CPUBus.h"
+
+using Byte = InstructionCache::Byte;
+using Word = InstructionCache::Word;
+
+InstructionCache::InstructionCache(void) : 
+	mInstructions(END - START + 1, CachedInstruction{ nullptr, 0, 0, 0, 0 }),
+	mGeneration(1)	//entries of generation 0 were never decoded
+{}
+
+void InstructionCache::invalidate(void) {
+	if (++mGeneration) { return; }
+	for (CachedInstruction& instruction : mInstructions) { instruction.generation = 0; } //the counter wrapped around
+	mGeneration = 1;
+}
+
+void InstructionCache::decode(CPUBus& bus, const Word& address, CachedInstruction& instruction) {
+	Byte opcode = bus.read(address);
+	const OpcodeInfo& info = OpcodeLUT::getInfo(opcode);
+	instruction.execute = OpcodeLUT::getDecodedInstruction(opcode);
+	instruction.length = info.length;
+	instruction.cycles = info.cycles;
+	switch (info.length) {
+		case 2: instruction.operand = bus.read(address + 1); break;
+		case 3: instruction.operand = bus.read(address + 2) << 8 | bus.read(address + 1); break;
+		default: instruction.operand = 0; break;
+	}
+	instruction.generation = mGeneration;
+}
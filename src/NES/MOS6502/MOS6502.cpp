@@ -1,10 +1,17 @@
 #include "NES/MOS6502/MOS6502.h"
 
+#include "NES/MOS6502/OpcodeLUT.h"
+
 using Byte = MOS6502::Byte;
 
 MOS6502::MOS6502() : 
-	mCycles(8),
+	mBlockCache(mInstructionCache),
+	mCycles(0),
+	mRunCycles(0),
+	mRunBudget(0),
+	mIdleCycles(0),
 	mAccAddressing(false),
+	mPageCrossed(false),
 	mDmaTransferOn(false),
 	mFetchedAddress(0),
 	mProgramCounter(0),
@@ -22,10 +29,47 @@ void MOS6502::boot(CPUBus& bus) {
 	this->readResetVector();
 }
 
-void MOS6502::clock(void) {
-	if (mDmaTransferOn) { mBus->dmaTransfer(); return; }
-	if (!mCycles) { this->executeInstruction(); }
-	--mCycles;
+unsigned int MOS6502::run(const unsigned int& budget) {
+	mRunCycles = 0;
+	mRunBudget = budget;
+	Word previous = mProgramCounter;
+	Word current = mProgramCounter;
+	do { 
+		previous = current;
+		current = mProgramCounter;
+		this->executeInstruction();
+#ifndef NES_CPU_NO_IDLE_SKIP
+		if ((Word)(current - mProgramCounter) <= 3 //a short jump back, which may close an idle loop
+			&& (current == mProgramCounter || previous == mProgramCounter)
+			&& !this->isRunOver()
+		) { this->skipIdleLoop(); }
+#endif // !NES_CPU_NO_IDLE_SKIP
+	} while (!this->isRunOver());
+	unsigned int cycles = mRunCycles;
+	mRunCycles = 0;
+	return cycles;
+}
+
+void MOS6502::skipIdleLoop(void) {
+	Word loop = mProgramCounter;
+	if ((loop > 0x1FFA && loop < 0x8000) || loop > 0xFFFA) { return; } //the loop has to be read without side effects
+
+	unsigned int period = 0;
+	Byte opcode = mBus->read(loop);
+	Word operand = mBus->read(loop + 2) << 8 | mBus->read(loop + 1);
+	if (opcode == 0x4C && operand == loop) { period = 3; } //JMP to itself
+	else if ((opcode == 0xAD || opcode == 0x2C) && operand == 0x2002) { //LDA/BIT $2002, BPL back
+		if (mBus->read(loop + 3) == 0x10 && mBus->read(loop + 4) == 0xFB) { period = 7; }
+	} else if (opcode == 0xA5) { //LDA zero page, BEQ/BNE back
+		Byte branch = mBus->read(loop + 2);
+		if ((branch == 0xF0 || branch == 0xD0) && mBus->read(loop + 3) == 0xFC) { period = 6; }
+	}
+	if (!period) { return; }
+
+	//the last iteration due in the run is executed for real
+	unsigned int iterations = (mRunBudget - 1 - mRunCycles) / period;
+	mRunCycles += iterations * period;
+	mIdleCycles += iterations * period;
 }
 
 void MOS6502::nmi(void) {
@@ -43,35 +87,12 @@ void MOS6502::readNmiVector(void) {
 	mProgramCounter = mBus->read(0xFFFB) << 8 | mBus->read(0xFFFA);
 }
 
+#if !defined(NES_CPU_SWITCH_CORE) && !defined(NES_CPU_CACHED_CORE) && !defined(NES_CPU_BLOCK_CORE)
 void MOS6502::executeInstruction(void) {
+	mCycles = 0;
 	Byte opcode = mBus->read(mProgramCounter++);
-	mOpcodes[opcode].execute(*this);
-}
-
-
-/* MEMORY OPERATIONS */
-
-
-Byte MOS6502::fetchByte(void) { return mBus->read(mProgramCounter++); }
-Byte MOS6502::fetchByte(const Word& address) { return mBus->read(address); }
-
-Byte MOS6502::fetchStack(void) {
-	Byte data = mBus->read(0x100 + (++mStackPointer));	//stkptr will be incremented before the read
-	return data;
-}
-void MOS6502::pushStack(const Byte& data) { 
-	mBus->write(data, 0x100 + mStackPointer--);			//stkptr will be decremented after the write
-}
-
-void MOS6502::writeMemory(const Byte& data, const Word& address) { 
-	mBus->write(data, address);
+	OpcodeLUT::getInstruction(opcode)(*this);
+	this->retireInstruction();
 }
+#endif // !NES_CPU_SWITCH_CORE && !NES_CPU_CACHED_CORE && !NES_CPU_BLOCK_CORE
 
-
-/* FLAG OPERATIONS */
-
-
-void MOS6502::setFlag(const ProcessorFlag& flag, const bool& state) {
-	if (state) { mStatusRegister |= flag; } 
-	else { mStatusRegister &= ~flag; }
-}
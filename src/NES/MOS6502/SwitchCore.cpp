@@ -0,0 +1,43 @@
+#include "NES/MOS6502/MOS6502.h"
+
+#ifdef NES_CPU_SWITCH_CORE
+
+#include "NES/MOS6502/OpcodeLUT.h"
+
+using Byte = MOS6502::Byte;
+
+/*
+* Alternative execution core of
+* the MOS6502 CPU. Instead of calling
+* the instructions through the pointers
+* of the opcode lookup table, every opcode
+* is handled by a single switch and the 
+* instruction is inlined into its case.
+* Both cores are generated from the same
+* Opcode specializations, so they behave
+* exactly the same.
+*/
+
+#define OPCODE_CASE(code) case code: Opcode<code>::Type::execute(*this); break;
+#define OPCODE_ROW(row) \
+	OPCODE_CASE(row | 0x0) OPCODE_CASE(row | 0x1) OPCODE_CASE(row | 0x2) OPCODE_CASE(row | 0x3) \
+	OPCODE_CASE(row | 0x4) OPCODE_CASE(row | 0x5) OPCODE_CASE(row | 0x6) OPCODE_CASE(row | 0x7) \
+	OPCODE_CASE(row | 0x8) OPCODE_CASE(row | 0x9) OPCODE_CASE(row | 0xA) OPCODE_CASE(row | 0xB) \
+	OPCODE_CASE(row | 0xC) OPCODE_CASE(row | 0xD) OPCODE_CASE(row | 0xE) OPCODE_CASE(row | 0xF)
+
+void MOS6502::executeInstruction(void) {
+	mCycles = 0;
+	Byte opcode = mBus->read(mProgramCounter++);
+	switch (opcode) {
+		OPCODE_ROW(0x00) OPCODE_ROW(0x10) OPCODE_ROW(0x20) OPCODE_ROW(0x30)
+		OPCODE_ROW(0x40) OPCODE_ROW(0x50) OPCODE_ROW(0x60) OPCODE_ROW(0x70)
+		OPCODE_ROW(0x80) OPCODE_ROW(0x90) OPCODE_ROW(0xA0) OPCODE_ROW(0xB0)
+		OPCODE_ROW(0xC0) OPCODE_ROW(0xD0) OPCODE_ROW(0xE0) OPCODE_ROW(0xF0)
+	}
+	this->retireInstruction();
+}
+
+#undef OPCODE_ROW
+#undef OPCODE_CASE
+
+#endif // NES_CPU_SWITCH_CORE
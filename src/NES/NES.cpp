@@ -1,29 +1,124 @@
-#include "NES/Nes.h"
+#include "NES/NES.h"
 
+#include <algorithm>
 #include <functional>
 
-NES::NES(Cartridge& cartridge) :
+NES::NES(Cartridge& cartridge, Frontend* frontend) :
 	mClock(0),
-	mWindow(Window::getInstance(mJoypads, ScreenOptions{"NES", 256, 240, 4}, AudioOptions{44100, 16, 1})),
-	mApu(mWindow, 44100),
+	mPpuClock(0),
+	mApuClock(0),
+	mDmaResumeCycles(0),
+	mScanlineRendering(true),
+	mFrontend(frontend),
+	mApu(44100),
 	mPpu(std::bind(&MOS6502::nmi, &mCpu)),
-	mCpuBus(mCpu, mPpu, mApu, cartridge, mJoypads, mClock),
+	mCpuBus(mCpu, mPpu, mApu, cartridge, mJoypads, mScheduler, 
+		[this]() { this->syncPpu(this->getCpuTime() + 1); },
+		[this]() { this->syncApu(this->getCpuTime()); }),
 	mPpuBus(cartridge)
 {
 	mCpu.boot(mCpuBus); 
-	mPpu.boot(mPpuBus, mWindow);
+	mPpu.boot(mPpuBus);
 	mApu.setCpuBus(&mCpuBus);
-}
+	mFrontend->connectJoypads(mJoypads);
 
-NES::~NES(void) {
-	mWindow->destroyInstance();
+	mScheduler.schedule(EVENT_NMI, mPpu.getDotsUntilVblank());
+	mScheduler.schedule(EVENT_CPU, CPU_CLOCK_DIVIDER * MOS6502::RESET_CYCLES);
+	//a step takes effect as soon as the APU cycle it falls on starts, the same way syncApu() rounds up the accesses
+	mScheduler.schedule(EVENT_APU, CPU_CLOCK_DIVIDER * mApu.getCyclesUntilFrameStep() - APU_CLOCK_DIVIDER + 1);
 }
 
 void NES::run(void) {
-	while (true) {  
-		mPpu.clock();
-		if (mClock % 3 == 0) { mCpu.clock(); }
-		if (mClock % 6 == 0) { mApu.clock(); }
-		++mClock;
+	while (mFrontend->isOpen()) {
+		Frame frame = this->runFrame();
+		mFrontend->queueAudio(frame.samples, frame.sampleCount);
+		mApu.setSampleRateRatio(mFrontend->getSampleRateRatio());
+		mFrontend->swapBuffers(frame.pixels, frame.hash);
+	}
+}
+
+Frame NES::runFrame(void) {
+	mApu.clearSamples();
+	this->runUntil(mScheduler.getTime(EVENT_NMI) + 1);
+	mApu.endFrame();
+	return this->getFrame();
+}
+
+Frame NES::runCycles(const unsigned long& cycles) {
+	mApu.clearSamples();
+	this->runUntil(mClock + CPU_CLOCK_DIVIDER * cycles);
+	mApu.endFrame();
+	return this->getFrame();
+}
+
+void NES::runUntil(const Cycle& time) {
+	while (true) {
+		SchedulerEvent event = mScheduler.getNextEvent();
+		Cycle eventTime = mScheduler.getTime(event);
+		if (eventTime >= time) { break; }
+		mScheduler.dispatch(event);
+		Cycle limit = std::min(time, mScheduler.getTime(mScheduler.getNextEvent()));
+		this->handleEvent(event, eventTime, limit);
+	}
+	this->syncPpu(time);
+	this->syncApu(time);
+	mClock = time;
+}
+
+void NES::syncPpu(const Cycle& time) {
+	while (mPpuClock < time) {
+		if (mScanlineRendering && mPpu.isScanlineStart() && time - mPpuClock >= PPU2C02::DOTS_PER_SCANLINE) { 
+			mPpu.clockScanline(); //nothing can access the PPU before the end of the scanline
+			mPpuClock += PPU2C02::DOTS_PER_SCANLINE;
+		} else {
+			mPpu.clock();
+			++mPpuClock;
+		}
 	}
 }
+
+void NES::syncApu(const Cycle& time) {
+	if (time <= mApuClock) { return; }
+	Cycle cycles = (time - mApuClock + APU_CLOCK_DIVIDER - 1) / APU_CLOCK_DIVIDER;
+	mApu.run((unsigned int)(cycles * APU_CLOCK_DIVIDER / CPU_CLOCK_DIVIDER));
+	mApuClock += APU_CLOCK_DIVIDER * cycles;
+}
+
+void NES::handleEvent(const SchedulerEvent& event, const Cycle& time, const Cycle& limit) {
+	switch (event) {
+		case EVENT_NMI: //the PPU calls the NMI itself when it enters vblank
+			this->syncPpu(time + 1);
+			mScheduler.schedule(EVENT_NMI, time + PPU2C02::DOTS_PER_FRAME);
+			break;
+		case EVENT_CPU: { //the CPU runs ahead until the next event, executing every instruction due before it
+			unsigned int cycles = mCpu.run((limit - time + CPU_CLOCK_DIVIDER - 1) / CPU_CLOCK_DIVIDER);
+			if (mCpu.isDmaTransferOn()) { //the last instruction has started the DMA
+				mDmaResumeCycles = mCpu.getCycles();
+				Cycle lastInstruction = time + CPU_CLOCK_DIVIDER * (cycles - mDmaResumeCycles);
+				mScheduler.schedule(EVENT_DMA, lastInstruction + CPU_CLOCK_DIVIDER);
+			} else { mScheduler.schedule(EVENT_CPU, time + CPU_CLOCK_DIVIDER * cycles); }
+			break;
+		}
+		case EVENT_APU: //the APU does no work between the frame sequencer steps
+			this->syncApu(time);
+			mApu.clockFrameSequencer();
+			mScheduler.schedule(EVENT_APU, time + CPU_CLOCK_DIVIDER * mApu.getCyclesUntilFrameStep());
+			break;
+		case EVENT_DMA:
+			mCpuBus.dmaTransfer();
+			if (mCpu.isDmaTransferOn()) { mScheduler.schedule(EVENT_DMA, time + CPU_CLOCK_DIVIDER); }
+			else { mScheduler.schedule(EVENT_CPU, time + CPU_CLOCK_DIVIDER * mDmaResumeCycles); }
+			break;
+		default: break;
+	}
+}
+
+Frame NES::getFrame(void) const {
+	return Frame{ 
+		mPpu.getFrameBuffer(), 
+		mApu.getSamples(), 
+		mApu.getSampleCount(),
+		mPpu.isFrameSkipped(),
+		mPpu.getFrameHash()
+	};
+}
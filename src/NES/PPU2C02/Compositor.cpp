@@ -0,0 +1,163 @@
+#include "NES/PPU2C02/Compositor.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define NES_COMPOSITOR_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif // _MSC_VER
+#endif // x86
+
+#if defined(NES_COMPOSITOR_X86) && (defined(__GNUC__) || defined(__clang__))
+#define TARGET_SSE2 __attribute__((target("sse2")))
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define TARGET_SSE2
+#define TARGET_AVX2
+#endif
+
+using Byte = Compositor::Byte;
+
+std::atomic<Compositor::ComposeFunction> Compositor::sCompose(&Compositor::dispatch);
+
+InstructionSet Compositor::getInstructionSet(void) {
+#ifdef NES_COMPOSITOR_X86
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) { return INSTRUCTION_SET_AVX2; }
+    if (__builtin_cpu_supports("sse2")) { return INSTRUCTION_SET_SSE2; }
+#elif defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    int maxLeaf = info[0];
+    __cpuid(info, 1);
+    bool sse2 = info[3] & (1 << 26);
+    bool osSavesYmm = (info[2] & (1 << 27)) && (_xgetbv(0) & 0x6) == 0x6; //OSXSAVE and the YMM state enabled
+    if (osSavesYmm && maxLeaf >= 7) {
+        __cpuidex(info, 7, 0);
+        if (info[1] & (1 << 5)) { return INSTRUCTION_SET_AVX2; }
+    }
+    if (sse2) { return INSTRUCTION_SET_SSE2; }
+#endif
+#endif // NES_COMPOSITOR_X86
+    return INSTRUCTION_SET_SCALAR;
+}
+
+Compositor::ComposeFunction Compositor::getComposeFunction(const InstructionSet& instructionSet) {
+    switch (instructionSet) {
+        case INSTRUCTION_SET_AVX2: return &Compositor::composeAvx2;
+        case INSTRUCTION_SET_SSE2: return &Compositor::composeSse2;
+        default: return &Compositor::composeScalar;
+    }
+}
+
+void Compositor::dispatch(const Byte* background, const Byte* sprites, const uint32_t* colours, uint32_t* line, const int& width) {
+    ComposeFunction function = getComposeFunction(getInstructionSet());
+    sCompose.store(function, std::memory_order_relaxed);
+    function(background, sprites, colours, line, width);
+}
+
+void Compositor::composeScalar(const Byte* background, const Byte* sprites, const uint32_t* colours, uint32_t* line, const int& width) {
+    for (int x = 0; x < width; ++x) {
+        Byte index = background[x];
+        if ((sprites[x] & 0x3) && (!index || (sprites[x] & 0x80))) { index = sprites[x] & 0x1F; }
+        line[x] = colours[index];
+    }
+}
+
+#ifdef NES_COMPOSITOR_X86
+
+TARGET_SSE2 void Compositor::composeSse2(const Byte* background, const Byte* sprites, const uint32_t* colours, uint32_t* line, const int& width) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i pixelMask = _mm_set1_epi8(0x3);
+    const __m128i indexMask = _mm_set1_epi8(0x1F);
+
+    alignas(16) Byte indices[16];
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        __m128i bg = _mm_loadu_si128((const __m128i*)&background[x]);
+        __m128i fg = _mm_loadu_si128((const __m128i*)&sprites[x]);
+
+        __m128i fgTransparent = _mm_cmpeq_epi8(_mm_and_si128(fg, pixelMask), zero);
+        __m128i bgTransparent = _mm_cmpeq_epi8(bg, zero);
+        __m128i fgInFront = _mm_cmplt_epi8(fg, zero); //priority is kept on the MSB
+        __m128i useFg = _mm_andnot_si128(fgTransparent, _mm_or_si128(bgTransparent, fgInFront));
+
+        __m128i index = _mm_or_si128(
+            _mm_and_si128(useFg, _mm_and_si128(fg, indexMask)),
+            _mm_andnot_si128(useFg, bg)
+        );
+        _mm_store_si128((__m128i*)indices, index);
+        for (int i = 0; i < 16; ++i) { line[x + i] = colours[indices[i]]; }
+    }
+    composeScalar(&background[x], &sprites[x], colours, &line[x], width - x);
+}
+
+TARGET_AVX2 void Compositor::composeAvx2(const Byte* background, const Byte* sprites, const uint32_t* colours, uint32_t* line, const int& width) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i pixelMask = _mm256_set1_epi8(0x3);
+    const __m256i indexMask = _mm256_set1_epi8(0x1F);
+    const __m256i highHalf = _mm256_set1_epi8(0x10);
+
+    //every channel of the colours gets split into two 16 entry tables for the byte shuffles
+    alignas(32) Byte channels[4][32];
+    for (int i = 0; i < 32; ++i) {
+        for (int channel = 0; channel < 4; ++channel) { channels[channel][i] = colours[i] >> (channel * 8); }
+    }
+    __m256i lowTables[4];
+    __m256i highTables[4];
+    for (int channel = 0; channel < 4; ++channel) {
+        lowTables[channel] = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*)&channels[channel][0]));
+        highTables[channel] = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*)&channels[channel][16]));
+    }
+
+    int x = 0;
+    for (; x + 32 <= width; x += 32) {
+        __m256i bg = _mm256_loadu_si256((const __m256i*)&background[x]);
+        __m256i fg = _mm256_loadu_si256((const __m256i*)&sprites[x]);
+
+        __m256i fgTransparent = _mm256_cmpeq_epi8(_mm256_and_si256(fg, pixelMask), zero);
+        __m256i bgTransparent = _mm256_cmpeq_epi8(bg, zero);
+        __m256i fgInFront = _mm256_cmpgt_epi8(zero, fg); //priority is kept on the MSB
+        __m256i useFg = _mm256_andnot_si256(fgTransparent, _mm256_or_si256(bgTransparent, fgInFront));
+        __m256i index = _mm256_blendv_epi8(bg, _mm256_and_si256(fg, indexMask), useFg);
+
+        __m256i useHighTable = _mm256_cmpeq_epi8(_mm256_and_si256(index, highHalf), highHalf);
+        __m256i bytes[4];
+        for (int channel = 0; channel < 4; ++channel) {
+            bytes[channel] = _mm256_blendv_epi8(
+                _mm256_shuffle_epi8(lowTables[channel], index),
+                _mm256_shuffle_epi8(highTables[channel], index),
+                useHighTable
+            );
+        }
+
+        //the unpacks work within the 128 bit lanes, which get put back in order at the end
+        __m256i redGreenLow = _mm256_unpacklo_epi8(bytes[0], bytes[1]);
+        __m256i redGreenHigh = _mm256_unpackhi_epi8(bytes[0], bytes[1]);
+        __m256i blueAlphaLow = _mm256_unpacklo_epi8(bytes[2], bytes[3]);
+        __m256i blueAlphaHigh = _mm256_unpackhi_epi8(bytes[2], bytes[3]);
+        __m256i pixels0 = _mm256_unpacklo_epi16(redGreenLow, blueAlphaLow);     //pixels 0-3 and 16-19
+        __m256i pixels1 = _mm256_unpackhi_epi16(redGreenLow, blueAlphaLow);     //pixels 4-7 and 20-23
+        __m256i pixels2 = _mm256_unpacklo_epi16(redGreenHigh, blueAlphaHigh);   //pixels 8-11 and 24-27
+        __m256i pixels3 = _mm256_unpackhi_epi16(redGreenHigh, blueAlphaHigh);   //pixels 12-15 and 28-31
+
+        _mm256_storeu_si256((__m256i*)&line[x], _mm256_permute2x128_si256(pixels0, pixels1, 0x20));
+        _mm256_storeu_si256((__m256i*)&line[x + 8], _mm256_permute2x128_si256(pixels2, pixels3, 0x20));
+        _mm256_storeu_si256((__m256i*)&line[x + 16], _mm256_permute2x128_si256(pixels0, pixels1, 0x31));
+        _mm256_storeu_si256((__m256i*)&line[x + 24], _mm256_permute2x128_si256(pixels2, pixels3, 0x31));
+    }
+    composeScalar(&background[x], &sprites[x], colours, &line[x], width - x);
+}
+
+#else
+
+void Compositor::composeSse2(const Byte* background, const Byte* sprites, const uint32_t* colours, uint32_t* line, const int& width) {
+    composeScalar(background, sprites, colours, line, width);
+}
+
+void Compositor::composeAvx2(const Byte* background, const Byte* sprites, const uint32_t* colours, uint32_t* line, const int& width) {
+    composeScalar(background, sprites, colours, line, width);
+}
+
+#endif // NES_COMPOSITOR_X86
@@ -1,6 +1,9 @@
 #include "NES/PPU2C02/PPU2C02.h"
 
 #include <cstdlib>
+#include <cstring>
+
+#include "NES/PPU2C02/Compositor.h"
 
 using Byte = PPU2C02::Byte;
 using Word = PPU2C02::Word;
@@ -8,8 +11,8 @@ using Word = PPU2C02::Word;
 PPU2C02::PPU2C02(std::function<void(void)> nmiCallback) :
     mNmiCallback(nmiCallback),
     mBus(nullptr),
-    mWindow(nullptr),
     mSpriteCount(0),
+    mSpriteListsDirty(true),
     mVRamAddr(0),
     mTRamAddr(0),
     mFineX(0),
@@ -28,7 +31,12 @@ PPU2C02::PPU2C02(std::function<void(void)> nmiCallback) :
     mWLatch(0),
     mDataBuffer(0),
     mScanline(-1),
-    mCycle(-1)
+    mCycle(-1),
+    mFrameCount(0),
+    mFrameSkip(1),
+    mSkipFrame(false),
+    mSkippedFrames(0),
+    mFrameHash(0)
 {
     memset(mRegisters, 0, 8);
     memset(mOam, 0, 256);
@@ -37,19 +45,98 @@ PPU2C02::PPU2C02(std::function<void(void)> nmiCallback) :
     memset(mFgPatternHi, 0, 8);
     memset(mFgAttrib, 0, 8);
     memset(mSpritesXPos, 0, 8);
+    memset(mFrameBuffer, 0, sizeof(mFrameBuffer));
+    mFrameHash = this->hashFrameBuffer();
 }
 
-void PPU2C02::boot(PPUBus& bus, Window* window) {
-    mBus = &bus;
-    mWindow = window;
-}
+void PPU2C02::boot(PPUBus& bus) { mBus = &bus; }
 
 void PPU2C02::clock(void) {
     this->updateState();
     this->draw();
     this->updatePosition();
-    if (mScanline == -1 && mCycle == -1)
-        mWindow->swapBuffers();
+}
+
+void PPU2C02::clockScanline(void) {
+
+    this->drawOffscreen(); //cycle -1
+
+    if (mScanline >= FRAME_HEIGHT) { //nothing changes after the visible scanlines, except for the vblank
+        if (mScanline == 241) {
+            mCycle = 0;
+            this->postRenderRoutine();
+        }
+        mCycle = 339;
+        this->updatePosition();
+        return;
+    }
+
+    mCycle = 0;
+    if (mScanline == -1) 
+        this->preRenderRoutine();
+
+    bool renderBackground = (mRegisters[PPUMASK] & MASK_REGISTER::RENDER_BACKGROUND) && !mSkipFrame;
+
+    Byte fgPixels[FRAME_WIDTH] = { 0 };
+    if (mRegisters[PPUMASK] & MASK_REGISTER::RENDER_SPRITES)
+        this->drawSpriteLine(mSkipFrame ? nullptr : fgPixels);
+
+    //colour indices of the background pixels, starting with the two tiles already in the shifters
+    Byte bgPixels[FRAME_WIDTH + 16] = { 0 };
+
+    for (int tile = 0; tile < FRAME_WIDTH / 8; ++tile) {    //cycles 0-255
+        this->shiftBackground(1);
+        this->loadBackgroundShifters();
+        if (!tile && renderBackground) {
+            for (int x = 0; x < 16; ++x) {
+                Byte pixel = ((mBgPatternLo >> (15 - x)) & 1) | (((mBgPatternHi >> (15 - x)) & 1) << 1);
+                Byte palette = ((mBgAttribLo >> (15 - x)) & 1) | (((mBgAttribHi >> (15 - x)) & 1) << 1);
+                bgPixels[x] = pixel ? (palette << 2) | pixel : 0;
+            }
+        }
+        this->shiftBackground(7);
+
+        const TileRow& row = this->fetchBackgroundTile();
+        if (renderBackground && tile < FRAME_WIDTH / 8 - 1) { //the last tile is shifted out at the end of the scanline
+            Byte* pixels = &bgPixels[16 + (tile << 3)];
+            for (int x = 0; x < 8; ++x) {
+                Byte pixel = (row.pixels >> (14 - 2 * x)) & 0x3;
+                pixels[x] = pixel ? (mBgTileAttribute << 2) | pixel : 0;
+            }
+        }
+    }
+
+    if (mScanline >= 0 && !mSkipFrame) {
+        Compositor::compose(&bgPixels[mFineX], fgPixels, mBus->getPaletteColours(), &mFrameBuffer[mScanline * FRAME_WIDTH], FRAME_WIDTH);
+    }
+
+    mCycle = 255;
+    this->incrementY();
+
+    mCycle = 256;
+    this->resetX();
+    mRegisters[OAMADDR] = 0x00;
+    this->drawOffscreen(); //the sprites stay still until the end of the scanline
+
+    if (mScanline == -1) 
+        this->resetY();
+
+    for (int tile = 0; tile < 2; ++tile) {  //cycles 320-335
+        this->shiftBackground(1);
+        this->loadBackgroundShifters();
+        this->shiftBackground(7);
+        this->fetchBackgroundTile();
+    }
+
+    mCycle = 339;
+    if (mScanline >= 0) {
+        memset(mSecondaryOam, 0xFF, 32);
+        mSpriteCount = 0;
+        this->evaluateOam();
+        this->updateSpriteData();
+        this->drawOffscreen();
+    }
+    this->updatePosition();
 }
 
 Byte PPU2C02::readRegister(Word address) {
@@ -93,6 +180,7 @@ void PPU2C02::writeRegister(const Byte& data, Word address) {
     
     switch (address) {
         case PPUCTRL:
+            if ((mRegisters[PPUCTRL] ^ data) & SPRTSIZ) { mSpriteListsDirty = true; }
             mRegisters[PPUCTRL] = data;
             mTRamAddr = (
                 (mTRamAddr & ~(NT_SWITCH)) 
@@ -101,6 +189,7 @@ void PPU2C02::writeRegister(const Byte& data, Word address) {
             break;
         case PPUMASK:
             mRegisters[PPUMASK] = data;
+            mBus->setColourMode(data & GRAYSCALE, (data & EMPHASIS) >> 5);
             break;
         case OAMADDR:
             mRegisters[OAMADDR] = data;
@@ -108,6 +197,7 @@ void PPU2C02::writeRegister(const Byte& data, Word address) {
         case OAMDATA:
             mOam[mRegisters[OAMADDR]] = data;
             ++mRegisters[OAMADDR];
+            mSpriteListsDirty = true;
             break;
         case PPUSCROLL:
             if (!mWLatch) {
@@ -154,6 +244,14 @@ void PPU2C02::startDmaTransfer(const Byte& data) {
 void PPU2C02::writeDma(const Byte& data) {
     mOam[mRegisters[OAMADDR]] = data;
     ++mRegisters[OAMADDR];
+    mSpriteListsDirty = true;
+}
+
+unsigned long PPU2C02::getDotsUntil(const short& scanline, const short& cycle) const {
+    long position = (mScanline + 1) * DOTS_PER_SCANLINE + (mCycle + 1);
+    long target = (scanline + 1) * DOTS_PER_SCANLINE + (cycle + 1);
+    long dots = target - position;
+    return dots < 0 ? dots + DOTS_PER_FRAME : dots;
 }
 
 void PPU2C02::updateState(void) {
@@ -199,6 +297,11 @@ void PPU2C02::updateState(void) {
 
 void PPU2C02::draw(void) {
 
+    if (mSkipFrame) { //only the sprite 0 hit matters if nothing is drawn
+        this->drawOffscreen();
+        return;
+    }
+
     Byte bgPixelCode = 0;
     Byte bgPaletteCode = 0;
 
@@ -253,8 +356,74 @@ void PPU2C02::draw(void) {
         }
     }
 
-    Byte colourCode = mBus->read(0x3F00 + (paletteCode << 2) + pixelCode);
-    mWindow->drawPixel(mCycle, mScanline, mColours[colourCode]);
+    if (mCycle >= 0 && mCycle < FRAME_WIDTH 
+        && mScanline >= 0 && mScanline < FRAME_HEIGHT)
+        mFrameBuffer[mScanline * FRAME_WIDTH + mCycle] = mBus->getPaletteColours()[(paletteCode << 2) + pixelCode];
+}
+
+void PPU2C02::drawOffscreen(void) {
+    if (!(mRegisters[PPUMASK] & MASK_REGISTER::RENDER_SPRITES))
+        return;
+
+    if (mSpritesXPos[0] == 0 && ((mFgPatternLo[0] | mFgPatternHi[0]) & 0x80))
+        this->setSprite0Hit();
+}
+
+void PPU2C02::drawSpriteLine(Byte* pixels) {
+
+    for (int i = 7; i >= 0; --i) { //sprites in the lower slots are drawn on top
+
+        int start = mSpritesXPos[i] - 1; //the sprite becomes visible a dot before its counter runs out
+        Byte palette = (mFgAttrib[i] & SPRITE_MASK::PALETTE) + 0x04;
+        Byte priority = mFgAttrib[i] & SPRITE_MASK::PRIORITY ? 0 : 0x80;
+
+        for (int x = 0; x < 8 && (pixels || !i); ++x) { //without the line buffer only the sprite 0 is drawn
+            int position = start + x;
+            if (position < 0 || position >= FRAME_WIDTH) { continue; }
+
+            Byte pixel = (
+                ((mFgPatternLo[i] >> (7 - x)) & 1)
+                | (((mFgPatternHi[i] >> (7 - x)) & 1) << 1)
+            );
+            if (!pixel) { continue; }
+
+            if (pixels) { pixels[position] = priority | (palette << 2) | pixel; }
+            if (!i && position != 254) { //the sprite 0 hit is ignored on the dot 254
+                mCycle = position;
+                this->setSprite0Hit();
+            }
+        }
+
+        int shifts = FRAME_WIDTH - mSpritesXPos[i];
+        mFgPatternLo[i] = shifts < 8 ? mFgPatternLo[i] << shifts : 0;
+        mFgPatternHi[i] = shifts < 8 ? mFgPatternHi[i] << shifts : 0;
+        mSpritesXPos[i] = 0;
+    }
+
+}
+
+void PPU2C02::shiftBackground(const int& dots) {
+    if (mRegisters[PPUMASK] & MASK_REGISTER::RENDER_BACKGROUND) {
+        mBgPatternLo <<= dots; mBgPatternHi <<= dots;
+        mBgAttribLo <<= dots; mBgAttribHi <<= dots;
+    }
+}
+
+void PPU2C02::loadBackgroundShifters(void) {
+    mBgPatternLo |= mBgTileLsb; 
+    mBgPatternHi |= mBgTileMsb;
+    mBgAttribLo |= mBgTileAttribute & 0b01 ? 0xFF : 0x00;
+    mBgAttribHi |= mBgTileAttribute & 0b10 ? 0xFF : 0x00;
+}
+
+const TileRow& PPU2C02::fetchBackgroundTile(void) {
+    mBgTileId = this->fetchBgNametable();
+    mBgTileAttribute = this->fetchBgAttribute();
+    const TileRow& row = mBus->readTileRow(this->getBgTileAddress(), false);
+    mBgTileLsb = row.planes[0];
+    mBgTileMsb = row.planes[1];
+    this->incrementX();
+    return row;
 }
 
 void PPU2C02::updatePosition(void) {
@@ -287,15 +456,18 @@ Byte PPU2C02::fetchBgAttribute(void) {
 
 }
 
-Byte PPU2C02::fetchBgTileData(const bool& fetchMsb) {
-    return mBus->read(
+Word PPU2C02::getBgTileAddress(void) const {
+    return (
         (mRegisters[PPUCTRL] & CTRL_REGISTER::BPTADDR ? 0x1000 : 0) //background address offset
         + (mBgTileId << 4)                                          //tileId * tileSize(16)
         + ((mVRamAddr & VRAM_MASK::FINE_Y) >> 12)                   //fine Y offset
-        + (fetchMsb ? 8 : 0)                                        //MSB offset
     );
 }
 
+Byte PPU2C02::fetchBgTileData(const bool& fetchMsb) {
+    return mBus->readTileRow(this->getBgTileAddress(), false).planes[fetchMsb];
+}
+
 Byte PPU2C02::fetchFgTileData(const bool& fetchMsb) {
 
     Word tileDataAddr = 0;
@@ -350,26 +522,15 @@ Byte PPU2C02::fetchFgTileData(const bool& fetchMsb) {
 
     }
 
-    tileDataAddr += fetchMsb ? 8 : 0;
-    Byte tileData = mBus->read(tileDataAddr);
-
-    if (mFgTileAttribute & SPRITE_MASK::FLIP_H) {
-        tileData = (tileData & 0xF0) >> 4 | (tileData & 0x0F) << 4;
-        tileData = (tileData & 0xCC) >> 2 | (tileData & 0x33) << 2;
-        tileData = (tileData & 0xAA) >> 1 | (tileData & 0x55) << 1;
-    }
-
-    return tileData;
+    bool flipped = mFgTileAttribute & SPRITE_MASK::FLIP_H;
+    return mBus->readTileRow(tileDataAddr, flipped).planes[fetchMsb];
 }
 
 void PPU2C02::updateBackgroundData(void) {
 
     switch (mCycle % 8) {
         case BG_FETCH_NT:
-            mBgPatternLo |= mBgTileLsb; 
-            mBgPatternHi |= mBgTileMsb;
-            mBgAttribLo |= mBgTileAttribute & 0b01 ? 0xFF : 0x00;
-            mBgAttribHi |= mBgTileAttribute & 0b10 ? 0xFF : 0x00;
+            this->loadBackgroundShifters();
             mBgTileId = this->fetchBgNametable();
             break;
         case BG_FETCH_AT: mBgTileAttribute = this->fetchBgAttribute(); break;
@@ -418,27 +579,86 @@ void PPU2C02::updateShifters(void) {
     }
 }
 
+uint64_t PPU2C02::hashFrameBuffer(void) const {
+    constexpr uint64_t PRIME_1 = 0x9E3779B185EBCA87ull;
+    constexpr uint64_t PRIME_2 = 0xC2B2AE3D27D4EB4Full;
+
+    uint64_t lanes[4] = { PRIME_1, PRIME_2, ~PRIME_1, ~PRIME_2 };
+    const uint32_t* pixels = mFrameBuffer;
+    for (int i = 0; i < FRAME_WIDTH * FRAME_HEIGHT; i += 8) { //two pixels per lane
+        for (int lane = 0; lane < 4; ++lane) {
+            uint64_t data = pixels[i + 2 * lane] | ((uint64_t)pixels[i + 2 * lane + 1] << 32);
+            uint64_t mixed = lanes[lane] ^ (data * PRIME_2);
+            lanes[lane] = ((mixed << 31) | (mixed >> 33)) * PRIME_1;
+        }
+    }
+
+    uint64_t hash = 0;
+    for (int lane = 0; lane < 4; ++lane) {
+        hash = (hash ^ lanes[lane]) * PRIME_1;
+        hash ^= hash >> 29;
+    }
+    return hash;
+}
+
+uint64_t PPU2C02::getStateHash(void) const {
+    uint64_t hash = 0xCBF29CE484222325ull; //FNV-1a
+    auto add = [&hash](const void* data, const size_t& size) {
+        const Byte* bytes = (const Byte*)data;
+        for (size_t i = 0; i < size; ++i) { hash = (hash ^ bytes[i]) * 0x100000001B3ull; }
+    };
+
+    add(mRegisters, sizeof(mRegisters));
+    add(mOam, sizeof(mOam));
+    add(mSecondaryOam, sizeof(mSecondaryOam));
+    const Word words[] = { mVRamAddr, mTRamAddr, mBgPatternLo, mBgPatternHi, mBgAttribLo, mBgAttribHi };
+    add(words, sizeof(words));
+    const Byte bytes[] = { 
+        mSpriteCount, mFineX, mBgTileId, mBgTileAttribute, mBgTileLsb, mBgTileMsb, 
+        mFgTileY, mFgTileId, mFgTileAttribute, mFgTileX, mWLatch, mDataBuffer 
+    };
+    add(bytes, sizeof(bytes));
+    add(mFgPatternLo, sizeof(mFgPatternLo));
+    add(mFgPatternHi, sizeof(mFgPatternHi));
+    add(mFgAttrib, sizeof(mFgAttrib));
+    add(mSpritesXPos, sizeof(mSpritesXPos));
+    const long position[] = { mScanline, mCycle, (long)mFrameCount };
+    add(position, sizeof(position));
+    return hash;
+}
+
 void PPU2C02::evaluateOam(void) {
 
-    Byte secondaryOamAddr = 0;
+    if (mSpriteListsDirty)
+        this->buildSpriteLists();
 
-    for (int i = 0; i < 64; ++i) {
+    Byte count = mScanlineSpriteCount[mScanline];
+    if (count > 8) { //more than 8 sprites on one scanline
+        mRegisters[PPUSTATUS] |= STATUS_REGISTER::SPRITE_OVERFLOW;
+        count = 8;
+    }
 
-        short diff = mScanline - mOam[i * 4]; //difference in Y coord of scanline and sprite
-        Byte spriteSize = mRegisters[PPUCTRL] & CTRL_REGISTER::SPRTSIZ ? 16 : 8;
-        if (diff < 0 || diff >= spriteSize) { continue; } //sprite not visible
+    for (int i = 0; i < count; ++i)
+        memcpy(&mSecondaryOam[i * 4], &mOam[mScanlineSprites[mScanline][i] * 4], 4);
+    mSpriteCount = count;
 
-        if (secondaryOamAddr > 31) { //more than 8 sprites on one scanline
-            mRegisters[PPUSTATUS] |= STATUS_REGISTER::SPRITE_OVERFLOW;
-            break;
-        }
+}
+
+void PPU2C02::buildSpriteLists(void) {
 
-        memcpy(&mSecondaryOam[secondaryOamAddr], &mOam[i * 4], 4);
-        secondaryOamAddr += 4; //increment by the sprite size
-        ++mSpriteCount;
+    memset(mScanlineSpriteCount, 0, sizeof(mScanlineSpriteCount));
+    Byte spriteSize = mRegisters[PPUCTRL] & CTRL_REGISTER::SPRTSIZ ? 16 : 8;
 
+    for (int i = 0; i < 64; ++i) {
+        for (int scanline = mOam[i * 4]; scanline < mOam[i * 4] + spriteSize && scanline < FRAME_HEIGHT; ++scanline) {
+            Byte& count = mScanlineSpriteCount[scanline];
+            if (count == 9) { continue; } //the scanline already overflows
+            if (count < 8) { mScanlineSprites[scanline][count] = i; }
+            ++count;
+        }
     }
 
+    mSpriteListsDirty = false;
 }
 
 void PPU2C02::setSprite0Hit(void) {
@@ -457,6 +677,7 @@ void PPU2C02::setSprite0Hit(void) {
 }
 
 void PPU2C02::preRenderRoutine(void) {
+    mSkipFrame = mFrameCount % mFrameSkip != 0;
     mRegisters[PPUSTATUS] &= ~STATUS_REGISTER::VBLANK;
     mRegisters[PPUSTATUS] &= ~STATUS_REGISTER::SPRITE_0;
     mRegisters[PPUSTATUS] &= ~STATUS_REGISTER::SPRITE_OVERFLOW;
@@ -470,6 +691,9 @@ void PPU2C02::preRenderRoutine(void) {
 
 void PPU2C02::postRenderRoutine(void) {
     mRegisters[PPUSTATUS] |= STATUS_REGISTER::VBLANK;
+    ++mFrameCount;
+    if (mSkipFrame) { ++mSkippedFrames; }
+    else { mFrameHash = this->hashFrameBuffer(); } //skipped frames leave the frame buffer as it was
     if (mRegisters[PPUCTRL] & CTRL_REGISTER::VBNMIEN)
         this->mNmiCallback();
 }
@@ -0,0 +1,53 @@
+#pragma warning (disable: 6262) //I'm deliberately allocating most of the app on the stack
+
+#include <chrono>
+#include <exception>
+#include <iomanip>
+#include <string>
+#include <iostream>
+
+#include "NES/NES.h"
+#include "NES/Cartridge/Cartridge.h"
+#include "IO/NullFrontend.h"
+
+int main(int argc, char* argv[]) {
+
+    if (argc < 2 || argc > 4) {
+      std::cout << "Incorrect number of arguments. Usage:\n";
+      std::cout << ">./NES_emulator_headless.exe <iNES filepath> [frame count] [frame skip]\n\n";
+      exit(0);
+    }
+
+    try {
+        unsigned long frameLimit = argc >= 3 ? std::stoul(argv[2]) : 600;
+        unsigned int frameSkip = argc == 4 ? std::stoul(argv[3]) : 1;
+
+        Cartridge cartridge(argv[1]);
+        NullFrontend frontend;
+        NES nes(cartridge, &frontend);
+        nes.setFrameSkip(frameSkip);
+
+        size_t sampleCount = 0;
+        uint64_t frameHash = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (unsigned long i = 0; i < frameLimit; ++i) {
+            Frame frame = nes.runFrame();
+            sampleCount += frame.sampleCount;
+            frameHash = frame.hash;
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        double fps = elapsed.count() > 0.0 ? frameLimit / elapsed.count() : 0.0;
+        double idle = nes.getCpuCycles() ? 100.0 * nes.getIdleCycles() / nes.getCpuCycles() : 0.0;
+
+        std::cout << frameLimit << " frames in " << elapsed.count() << " s ("
+            << fps << " fps), "
+            << sampleCount << " audio samples, "
+            << nes.getSkippedFrames() << " frames skipped, "
+            << idle << "% of CPU cycles skipped in idle loops\n";
+        std::cout << "Last frame hash: " << std::hex << std::setw(16) << std::setfill('0') << frameHash << "\n";
+    } catch (std::exception& error) {   //also the invalid numbers from std::stoul
+        std::cout << error.what() << "\n\n";
+        exit(0);
+    }
+
+}
@@ -1,9 +1,12 @@
 #pragma warning (disable: 6262) //I'm deliberately allocating most of the app on the stack
 
+#include <exception>
 #include <iostream>
+#include <thread>
 
 #include "NES/NES.h"
 #include "NES/Cartridge/Cartridge.h"
+#include "IO/Window.h"
 
 int main(int argc, char* argv[]) {
 
@@ -15,11 +18,38 @@ int main(int argc, char* argv[]) {
 
     try {
         Cartridge cartridge(argv[1]);
-        NES nes(cartridge);
-        nes.run();
+        Window* window = Window::getInstance(ScreenOptions{"NES", 256, 240, 4}, AudioOptions{44100, 16, 1});
+        NES nes(cartridge, window);
+
+        std::exception_ptr emulationError;
+        std::thread emulation([&]() {   //the window presents the frames on this thread
+            try { nes.run(); } 
+            catch (...) { 
+                emulationError = std::current_exception(); 
+                window->close();
+            }
+        });
+        try { window->present(); }
+        catch (...) {   //the thread has to be joined before it goes out of scope
+            window->close();
+            emulation.join();
+            throw;
+        }
+        emulation.join();
+
+        FrameStats stats = window->getFrameStats();
+        std::cout << stats.framesPresented << " of " << stats.framesEmulated << " frames presented ("
+            << stats.framesDropped << " dropped, " << stats.framesUnchanged << " unchanged), emulation " << stats.emulationTime << " ms/frame, presentation "
+            << stats.presentationTime << " ms/frame, latency " << stats.latency << " ms (max "
+            << stats.maxLatency << " ms)\n";
+        AudioStats audioStats = window->getAudioStats();
+        std::cout << "Audio: " << audioStats.underruns << " underruns, " << audioStats.overruns << " overruns\n";
+
+        Window::destroyInstance();
+        if (emulationError) { std::rethrow_exception(emulationError); }
     } catch (std::runtime_error& error) {
         std::cout << error.what() << "\n\n";
         exit(0);
     }
 
-}
\ No newline at end of file
+}
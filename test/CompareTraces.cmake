@@ -0,0 +1,36 @@
+# Runs the lockstep programs of the TABLE core (REFERENCE)
+# and of another core (CORE) and compares the hashes of their
+# traces. The programs get written to WORKING_DIRECTORY, so
+# the tests of the cores can run in parallel.
+
+cmake_minimum_required(VERSION 3.8)
+
+file(MAKE_DIRECTORY ${WORKING_DIRECTORY})
+
+foreach(PROGRAM REFERENCE CORE)
+    execute_process(
+        COMMAND ${${PROGRAM}} ${WORKING_DIRECTORY}/${PROGRAM}.nes
+        OUTPUT_VARIABLE ${PROGRAM}_HASHES
+        RESULT_VARIABLE ${PROGRAM}_RESULT
+    )
+    if (NOT ${PROGRAM}_RESULT EQUAL 0)
+        message(FATAL_ERROR "${${PROGRAM}} failed:\n${${PROGRAM}_HASHES}")
+    endif()
+endforeach()
+
+if (NOT REFERENCE_HASHES STREQUAL CORE_HASHES)
+    string(REPLACE "\n" ";" REFERENCE_LINES "${REFERENCE_HASHES}")
+    string(REPLACE "\n" ";" CORE_LINES "${CORE_HASHES}")
+    set(MISMATCHES "")
+    foreach(LINE IN LISTS CORE_LINES)
+        if (NOT LINE IN_LIST REFERENCE_LINES)
+            string(APPEND MISMATCHES "  ${LINE}\n")
+        endif()
+    endforeach()
+    message(FATAL_ERROR 
+        "The traces differ from the TABLE core in:\n${MISMATCHES}"
+        "Diff the traces of a program with:\n"
+        "  ${REFERENCE} <iNES file> <program>\n"
+        "  ${CORE} <iNES file> <program>"
+    )
+endif()
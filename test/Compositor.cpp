@@ -0,0 +1,121 @@
+#include <cstdint>
+#include <cstdio>
+#include <initializer_list>
+#include <random>
+#include <vector>
+
+#include "NES/PPU2C02/Compositor.h"
+
+/**
+* Composes random scanlines with every
+* instruction set the host supports and
+* checks that the SIMD compositors give
+* exactly the same pixels as the scalar
+* one. The lines mix transparent and
+* opaque pixels of the background and
+* the sprites with both priorities, and
+* they start at every offset and end at
+* every width around the vector sizes,
+* so the remainders are covered too.
+*/
+
+using Byte = uint8_t;
+
+/** Number of random lines per width */
+static constexpr unsigned int LINE_COUNT = 64;
+
+/** Longest composed line */
+static constexpr int MAX_WIDTH = 256;
+
+/** Marks the pixels a compositor mustn't write */
+static constexpr uint32_t GUARD = 0xDEADBEEF;
+
+/**
+* Returns a background pixel,
+* transparent a quarter of the time.
+*
+* @param random generator of the line
+*
+* @return colour index of the pixel
+*/
+static Byte randomBackground(std::mt19937& random) {
+    Byte pixel = random() % 4;
+    return pixel ? (Byte)((random() % 8) * 4 + pixel) : 0;
+}
+
+/**
+* Returns a sprite pixel with a random
+* priority, transparent a quarter of the
+* time. The unused bits are random too,
+* the compositors have to ignore them.
+*
+* @param random generator of the line
+*
+* @return sprite pixel
+*/
+static Byte randomSprite(std::mt19937& random) {
+    return (Byte)random();
+}
+
+/**
+* Composes a line with every supported
+* instruction set and compares the
+* results with the scalar compositor.
+*
+* @param random generator of the line
+* @param width number of composed pixels
+* @param offset offset of the first pixel
+*   in the line buffers
+*
+* @return true if all the results
+*   are the same
+*/
+static bool compareLine(std::mt19937& random, const int& width, const int& offset) {
+    std::vector<Byte> background(MAX_WIDTH + 32);
+    std::vector<Byte> sprites(MAX_WIDTH + 32);
+    uint32_t colours[32];
+    for (Byte& pixel : background) { pixel = randomBackground(random); }
+    for (Byte& pixel : sprites) { pixel = randomSprite(random); }
+    for (uint32_t& colour : colours) { colour = (uint32_t)random(); }
+
+    std::vector<uint32_t> expected(MAX_WIDTH + 32, GUARD);
+    Compositor::compose(INSTRUCTION_SET_SCALAR, &background[offset], &sprites[offset], colours, &expected[offset], width);
+    for (int x = 0; x < width; ++x) {
+        Byte index = background[offset + x];
+        Byte sprite = sprites[offset + x];
+        if ((sprite & 0x3) && (!index || (sprite & 0x80))) { index = sprite & 0x1F; }
+        if (expected[offset + x] != colours[index]) {
+            std::printf("scalar: pixel %d of width %d at offset %d is %08X instead of %08X\n",
+                x, width, offset, expected[offset + x], colours[index]);
+            return false;
+        }
+    }
+
+    for (InstructionSet instructionSet : { INSTRUCTION_SET_SSE2, INSTRUCTION_SET_AVX2 }) {
+        if (instructionSet > Compositor::getInstructionSet()) { continue; }
+
+        std::vector<uint32_t> line(MAX_WIDTH + 32, GUARD);
+        Compositor::compose(instructionSet, &background[offset], &sprites[offset], colours, &line[offset], width);
+        for (size_t x = 0; x < line.size(); ++x) {
+            if (line[x] != expected[x]) {
+                std::printf("%s: pixel %d of width %d at offset %d is %08X instead of %08X\n",
+                    instructionSet == INSTRUCTION_SET_AVX2 ? "AVX2" : "SSE2", (int)x - offset, width, offset, line[x], expected[x]);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+int main(void) {
+    static const char* names[] = { "scalar", "SSE2", "AVX2" };
+    std::printf("comparing the compositors up to %s\n", names[Compositor::getInstructionSet()]);
+
+    std::mt19937 random(0);
+    for (int width = 0; width <= MAX_WIDTH; ++width) {
+        for (unsigned int line = 0; line < LINE_COUNT; ++line) {
+            if (!compareLine(random, width, line % 32)) { return 1; }
+        }
+    }
+    return 0;
+}
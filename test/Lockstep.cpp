@@ -0,0 +1,339 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <initializer_list>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "NES/NES.h"
+#include "NES/Cartridge/Cartridge.h"
+#include "NES/MOS6502/OpcodeLUT.h"
+#include "IO/NullFrontend.h"
+
+#include "TestRom.h"
+
+/**
+* Runs the emulator on random programs
+* with random budgets and traces the
+* registers, cycles and RAM of the CPU.
+* It gets built once for every CPU core
+* and the tests compare the traces of
+* the cores with the trace of the TABLE
+* core, so all of them have to execute
+* every program in exactly the same way.
+* The TABLE core is built without the
+* idle loop skipping, so the programs
+* waiting in idle loops also check that
+* the skipped iterations leave the CPU
+* exactly where running them would.
+*/
+
+using Byte = uint8_t;
+using Word = uint16_t;
+
+/** Number of random programs */
+static constexpr unsigned int PROGRAM_COUNT = 64;
+
+/** Number of programs waiting in idle loops, numbered after the random ones */
+static constexpr unsigned int IDLE_PROGRAM_COUNT = 20;
+
+/** Number of emulation runs per program */
+static constexpr unsigned int RUN_COUNT = 8000;
+
+/** Longest emulation run in CPU cycles */
+static constexpr unsigned int MAX_RUN_CYCLES = 48;
+
+/** Number of runs between the RAM and frame hashes */
+static constexpr unsigned int HASH_INTERVAL = 32;
+
+/** Size of the PRG ROM of the programs */
+static constexpr Word PRG_ROM_SIZE = 32768;
+
+/**
+* Hashes the given bytes with the
+* 64-bit FNV-1a hash.
+*
+* @param data bytes to be hashed
+* @param size number of bytes
+* @param hash hash of the preceding data
+*
+* @return hash of the data
+*/
+static uint64_t hashBytes(const void* data, const size_t& size, uint64_t hash = 0xCBF29CE484222325) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 0x100000001B3;
+    }
+    return hash;
+}
+
+/**
+* Tells if an instruction
+* writes into memory.
+*
+* @param info disassembly information
+*   of the instruction
+*
+* @return true if the instruction
+*   writes into memory
+*/
+static bool isWrite(const OpcodeInfo& info) {
+    std::string_view label = info.label;
+    for (const char* operation : { "ST", "INC", "DEC", "ASL", "LSR", "ROL", "ROR" }) {
+        if (label.starts_with(operation) && info.length > 1) { return true; }
+    }
+    return false;
+}
+
+/**
+* Picks a random address for an
+* absolute operand. Writes go only
+* to the RAM and the registers, since
+* writing into ROM stops the emulator.
+*
+* @param random generator of the program
+* @param write whether the instruction
+*   writes into memory
+*
+* @return operand address
+*/
+static Word randomAddress(std::mt19937& random, const bool& write) {
+    switch (random() % 4) {
+        case 0: return random() % 2 ? 0x2000 + random() % 8 : 0x4000 + random() % 0x18;
+        case 1: if (!write) { return 0x8000 | (random() & 0x7FFF); } [[fallthrough]];
+        default: return random() & 0x1FFF;
+    }
+}
+
+/**
+* Picks a random instruction that
+* neither writes into memory nor
+* changes the flow of the program
+* or the stack.
+*
+* @param random generator of the program
+*
+* @return opcode of the instruction
+*/
+static Byte randomWork(std::mt19937& random) {
+    while (true) {
+        Byte code = (Byte)random();
+        const OpcodeInfo& info = OpcodeLUT::getInfo(code);
+        std::string_view label = info.label;
+        bool stack = label.starts_with("PH") || label.starts_with("PL") || label == "TXS";
+        if (info.cycles && info.length <= 2 && !info.controlFlow && !isWrite(info) && !stack) { return code; }
+    }
+}
+
+/**
+* Generates a random program made
+* of random defined opcodes. Jumps,
+* branches and interrupt vectors
+* lead to the starts of the instructions,
+* so the program runs for a while before
+* it gets to some garbage. Writes into ROM
+* are still possible, e.g. through the
+* indirect addressing.
+*
+* @param prgRom PRG ROM filled with NOPs
+* @param random generator of the program
+*/
+static void generateRandomProgram(std::vector<Byte>& prgRom, std::mt19937& random) {
+    std::vector<Word> starts;
+    for (Word offset = 0; offset + 3 <= PRG_ROM_SIZE - 6;) { //the last 6 bytes hold the vectors
+        Byte code = (Byte)random();
+        const OpcodeInfo& info = OpcodeLUT::getInfo(code);
+        if (info.cycles == 0) { continue; } //undefined opcode
+        prgRom[offset] = code;
+        starts.push_back(0x8000 + offset);
+        offset += info.length;
+    }
+
+    auto randomStart = [&](const Word& low, const Word& high) {
+        auto first = std::lower_bound(starts.begin(), starts.end(), low);
+        auto last = std::upper_bound(starts.begin(), starts.end(), high);
+        return *(first + random() % (last - first));
+    };
+
+    for (const Word& start : starts) {
+        Byte* instruction = &prgRom[start - 0x8000];
+        const OpcodeInfo& info = OpcodeLUT::getInfo(instruction[0]);
+        if (info.length == 2 && info.controlFlow) { //branch
+            Word next = start + 2;
+            instruction[1] = (Byte)(randomStart(std::max(next - 128, 0x8000), std::min(next + 127, 0xFFFF)) - next);
+        } else if (info.length == 2) {
+            instruction[1] = (Byte)random();
+        } else if (info.length == 3) {
+            Word address = info.controlFlow && std::string_view(info.label).ends_with("Absolute")
+                ? randomStart(0x8000, 0xFFFF) 
+                : randomAddress(random, isWrite(info));
+            instruction[1] = (Byte)address;
+            instruction[2] = (Byte)(address >> 8);
+        }
+    }
+
+    for (Word vector = PRG_ROM_SIZE - 6; vector < PRG_ROM_SIZE; vector += 2) {
+        Word address = randomStart(0x8000, 0xFFFF);
+        prgRom[vector] = (Byte)address;
+        prgRom[vector + 1] = (Byte)(address >> 8);
+    }
+}
+
+/**
+* Generates a program waiting in one
+* of the idle loops recognized by the
+* CPU, picked by the program number:
+* JMP to itself, LDA/BIT $2002 with BPL
+* and LDA from the zero page with BEQ/BNE.
+* The NMI is enabled, so the loops wait
+* across the NMIs, whose handler changes
+* the zero page value the loops wait on.
+* Both the main loop and the handler do
+* some random work around the waits.
+*
+* @param prgRom PRG ROM filled with NOPs
+* @param random generator of the program
+* @param program number of the program
+*/
+static void generateIdleProgram(std::vector<Byte>& prgRom, std::mt19937& random, const unsigned int& program) {
+    Word offset = 0;
+    auto emit = [&](std::initializer_list<int> bytes) {
+        for (int byte : bytes) { prgRom[offset++] = (Byte)byte; }
+    };
+    auto emitWork = [&]() {
+        for (unsigned int count = random() % 8; count > 0; --count) {
+            Byte code = randomWork(random);
+            emit({ code });
+            if (OpcodeLUT::getInfo(code).length == 2) { emit({ (int)(random() & 0xFF) }); }
+        }
+    };
+
+    unsigned int loop = program % 5;
+    Byte zeroPage = (Byte)random();
+    emit({ 0x78, 0xD8, 0xA2, 0xFF, 0x9A });        //SEI, CLD, LDX #$FF, TXS
+    emit({ 0xA9, 0x80, 0x8D, 0x00, 0x20 });        //LDA #$80, STA $2000
+    Word main = 0x8000 + offset;
+    emitWork();
+    Word start = 0x8000 + offset;
+    switch (loop) {
+        case 0: emit({ 0x4C, start & 0xFF, start >> 8 }); break;   //JMP to itself
+        case 1: emit({ 0xAD, 0x02, 0x20, 0x10, 0xFB }); break;     //LDA $2002, BPL
+        case 2: emit({ 0x2C, 0x02, 0x20, 0x10, 0xFB }); break;     //BIT $2002, BPL
+        case 3: emit({ 0xA9, 0x00, 0x85, zeroPage, 0xA5, zeroPage, 0xF0, 0xFC }); break; //LDA #0, STA zp, LDA zp, BEQ
+        case 4: emit({ 0xA9, 0x01, 0x85, zeroPage, 0xA5, zeroPage, 0xD0, 0xFC }); break; //LDA #1, STA zp, LDA zp, BNE
+    }
+    emit({ 0x4C, main & 0xFF, main >> 8 });
+
+    offset = 0x1000;
+    Word nmi = 0x8000 + offset;
+    emitWork();
+    if (loop == 3) { emit({ 0xE6, zeroPage }); }                   //INC zp
+    else if (loop == 4) { emit({ 0xA9, 0x00, 0x85, zeroPage }); }  //LDA #0, STA zp
+    emit({ 0x40 });                                                 //RTI
+
+    const Word vectors[3] = { nmi, 0x8000, nmi };
+    for (int i = 0; i < 3; ++i) {
+        prgRom[PRG_ROM_SIZE - 6 + 2 * i] = (Byte)vectors[i];
+        prgRom[PRG_ROM_SIZE - 5 + 2 * i] = (Byte)(vectors[i] >> 8);
+    }
+}
+
+/**
+* Writes a mapper 0 iNES file with
+* the given program in 32KB of PRG ROM
+* and 8KB of random CHR ROM.
+*
+* @param filePath path of the file
+* @param random generator of the program
+* @param program number of the program
+*/
+static void writeProgram(const std::string& filePath, std::mt19937& random, const unsigned int& program) {
+    std::vector<Byte> prgRom(PRG_ROM_SIZE, 0xEA); //NOPs
+    if (program < PROGRAM_COUNT) { generateRandomProgram(prgRom, random); }
+    else { generateIdleProgram(prgRom, random, program); }
+
+    Byte flags = random() & 1;
+    std::vector<Byte> chrRom(8192);
+    for (Byte& byte : chrRom) { byte = (Byte)random(); }
+    writeTestRom(filePath, prgRom, chrRom, flags);
+}
+
+/**
+* Runs a single random program.
+*
+* @param filePath path of the
+*   scratch iNES file
+* @param program number of the program
+* @param trace whether every run gets
+*   printed, or only the hash of them
+*
+* @return hash of the trace
+*/
+static uint64_t runProgram(const std::string& filePath, const unsigned int& program, const bool& trace) {
+    std::mt19937 random(program);
+    writeProgram(filePath, random, program);
+
+    Cartridge cartridge(filePath);
+    NullFrontend frontend;
+    NES nes(cartridge, &frontend);
+    const MOS6502& cpu = nes.getCpu();
+
+    uint64_t hash = hashBytes(nullptr, 0);
+    for (unsigned int i = 0; i < RUN_COUNT; ++i) {
+        char line[128];
+        Frame frame;
+        try { frame = nes.runCycles(random() % MAX_RUN_CYCLES + 1); }
+        catch (std::runtime_error& error) { //e.g. a write into ROM, the program ends there
+            int length = std::snprintf(line, sizeof(line), "%u: %s", i, error.what());
+            if (trace) { std::puts(line); }
+            return hashBytes(line, length, hash);
+        }
+
+        int length = std::snprintf(line, sizeof(line), "%u: PC:%04X A:%02X X:%02X Y:%02X P:%02X SP:%02X CYC:%u",
+            i, cpu.getProgramCounter(), cpu.getAccumulator(), cpu.getX(), cpu.getY(),
+            cpu.getProcessorStatus(), cpu.getStackPointer(), cpu.getCycles());
+        if (i % HASH_INTERVAL == 0) {
+            length += std::snprintf(line + length, sizeof(line) - length, " RAM:%016llX FRAME:%016llX",
+                (unsigned long long)hashBytes(nes.getRam(), 2048), (unsigned long long)frame.hash);
+        }
+
+        if (trace) { std::puts(line); }
+        hash = hashBytes(line, length, hash);   //the skipped cycles aren't hashed, the reference doesn't skip any
+    }
+    if (trace) { std::printf("IDLE:%llu\n", cpu.getIdleCycles()); }
+
+#ifndef NES_CPU_NO_IDLE_SKIP
+    if (program >= PROGRAM_COUNT && !cpu.getIdleCycles()) {
+        throw std::runtime_error("Error: No idle loop skipped in program " + std::to_string(program));
+    }
+#endif // !NES_CPU_NO_IDLE_SKIP
+    return hash;
+}
+
+int main(int argc, char* argv[]) {
+
+    if (argc < 2 || argc > 3) {
+        std::printf("Incorrect number of arguments. Usage:\n");
+        std::printf(">./NES_emulator_lockstep_<core> <scratch iNES filepath> [program]\n\n");
+        std::printf("Prints the trace hash of every program, or the whole trace of the given one.\n");
+        return 1;
+    }
+
+    try {
+        if (argc == 3) {
+            runProgram(argv[1], std::stoul(argv[2]), true);
+            return 0;
+        }
+        for (unsigned int program = 0; program < PROGRAM_COUNT + IDLE_PROGRAM_COUNT; ++program) {
+            std::printf("program %u: %016llX\n", program, (unsigned long long)runProgram(argv[1], program, false));
+        }
+    } catch (std::exception& error) {
+        std::printf("%s\n\n", error.what());
+        return 1;
+    }
+
+}
@@ -0,0 +1,251 @@
+#include <cstdint>
+#include <cstdio>
+#include <initializer_list>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "NES/NES.h"
+#include "NES/Cartridge/Cartridge.h"
+#include "IO/NullFrontend.h"
+
+#include "TestRom.h"
+
+/**
+* Runs generated programs twice, once
+* rendering the whole scanlines at once
+* and once rendering every scanline dot
+* by dot, and checks that the frame hash,
+* PPUSTATUS and the internal state of the
+* PPU are the same after every run. The
+* programs draw random tiles and sprites,
+* with sprite 0 hits and sprite overflows,
+* and write the PPU registers at all kinds
+* of dots, so the scanlines split by the
+* writes fall back to the dot renderer.
+*/
+
+using Byte = uint8_t;
+using Word = uint16_t;
+
+/** Number of generated programs */
+static constexpr unsigned int PROGRAM_COUNT = 16;
+
+/** Number of frames per program */
+static constexpr unsigned long FRAME_COUNT = 20;
+
+/** Longest emulation run in CPU cycles */
+static constexpr unsigned int MAX_RUN_CYCLES = 2000;
+
+/**
+* Writes 6502 machine code
+* into the PRG ROM.
+*/
+struct Assembler {
+
+    /** PRG ROM mapped at $8000 */
+    std::vector<Byte>& prgRom;
+
+    /** Address of the next byte */
+    Word address;
+
+    /**
+    * Writes the given bytes.
+    *
+    * @param bytes opcode and operand
+    *   bytes of an instruction
+    */
+    void emit(std::initializer_list<int> bytes) {
+        for (int byte : bytes) { prgRom[address++ - 0x8000] = (Byte)byte; }
+    }
+
+    /**
+    * Writes a branch back to
+    * a given address.
+    *
+    * @param opcode opcode of the branch
+    * @param target address of the loop
+    */
+    void branch(const int& opcode, const Word& target) { this->emit({ opcode, (Byte)(target - (address + 2)) }); }
+
+};
+
+/**
+* Generates a program. It fills the
+* nametables, the palette and OAM with
+* random data, where 12 sprites share
+* a scanline, and enables rendering and
+* the NMI. The main loop optionally waits
+* for the sprite 0 hit, waits for a growing
+* number of cycles and then writes or
+* reads random PPU registers. The NMI
+* handler starts the OAM DMA, moves the
+* sprite 0 and sets the scroll.
+*
+* @param prgRom 32KB of PRG ROM
+* @param random generator of the program
+*/
+static void generateProgram(std::vector<Byte>& prgRom, std::mt19937& random) {
+    for (Word address = 0xC000; address < 0xD100; ++address) { prgRom[address - 0x8000] = (Byte)random(); }
+    for (Word address = 0xC800; address < 0xC820; ++address) { prgRom[address - 0x8000] &= 0x3F; }  //palette
+    Byte overflowY = (Byte)(16 + random() % 200);
+    for (int sprite = 1; sprite < 12; ++sprite) { prgRom[0xD000 + 4 * sprite - 0x8000] = overflowY; }
+
+    Byte control = 0x80 | (random() & 0x3F);
+    auto randomMask = [&]() { return (int)(random() % 4 ? 0x18 | (random() & 0xE7) : random() & 0xFF); };
+
+    Assembler code{ prgRom, 0x8000 };
+    code.emit({ 0x78, 0xD8, 0xA2, 0xFF, 0x9A });                           //SEI, CLD, LDX #$FF, TXS
+    code.emit({ 0xA9, 0x00, 0x8D, 0x00, 0x20, 0x8D, 0x01, 0x20 });         //LDA #0, STA $2000, STA $2001
+    for (int i = 0; i < 2; ++i) {                                          //wait for the PPU to warm up
+        Word wait = code.address;
+        code.emit({ 0x2C, 0x02, 0x20 });                                   //BIT $2002
+        code.branch(0x10, wait);                                           //BPL
+    }
+
+    code.emit({ 0xA9, 0x3F, 0x8D, 0x06, 0x20, 0xA9, 0x00, 0x8D, 0x06, 0x20, 0xA2, 0x00 }); //PPUADDR = $3F00, LDX #0
+    Word palette = code.address;
+    code.emit({ 0xBD, 0x00, 0xC8, 0x8D, 0x07, 0x20, 0xE8, 0xE0, 0x20 });   //LDA $C800,X, STA $2007, INX, CPX #32
+    code.branch(0xD0, palette);                                            //BNE
+
+    code.emit({ 0xA9, 0x20, 0x8D, 0x06, 0x20, 0xA9, 0x00, 0x8D, 0x06, 0x20 }); //PPUADDR = $2000
+    code.emit({ 0xA9, 0x00, 0x85, 0x00, 0xA9, 0xC0, 0x85, 0x01 });         //($00) = $C000
+    code.emit({ 0xA2, 0x08, 0xA0, 0x00 });                                 //LDX #8, LDY #0
+    Word nametables = code.address;
+    code.emit({ 0xB1, 0x00, 0x8D, 0x07, 0x20, 0xC8 });                     //LDA ($00),Y, STA $2007, INY
+    code.branch(0xD0, nametables);                                         //BNE
+    code.emit({ 0xE6, 0x01, 0xCA });                                       //INC $01, DEX
+    code.branch(0xD0, nametables);                                         //BNE
+
+    code.emit({ 0xA2, 0x00 });                                             //LDX #0
+    Word oam = code.address;
+    code.emit({ 0xBD, 0x00, 0xD0, 0x9D, 0x00, 0x02, 0xE8 });               //LDA $D000,X, STA $0200,X, INX
+    code.branch(0xD0, oam);                                                //BNE
+
+    code.emit({ 0xA9, 0x00, 0x8D, 0x05, 0x20, 0x8D, 0x05, 0x20 });         //scroll = 0, 0
+    code.emit({ 0xA9, control, 0x8D, 0x00, 0x20 });                        //LDA #control, STA $2000
+    code.emit({ 0xA9, randomMask(), 0x8D, 0x01, 0x20 });                   //LDA #mask, STA $2001
+
+    Word main = code.address;
+    if (random() % 2) {
+        Word hitCleared = code.address;
+        code.emit({ 0x2C, 0x02, 0x20 });                                   //BIT $2002
+        code.branch(0x70, hitCleared);                                     //BVS
+        Word hitSet = code.address;
+        code.emit({ 0x2C, 0x02, 0x20 });                                   //BIT $2002
+        code.branch(0x50, hitSet);                                         //BVC
+    }
+    code.emit({ 0xA6, 0x10 });                                             //LDX $10
+    Word delay = code.address;
+    code.emit({ 0xCA });                                                   //DEX
+    code.branch(0xD0, delay);                                              //BNE
+    code.emit({ 0xE6, 0x10 });                                             //INC $10
+
+    for (unsigned int count = random() % 4 + 1; count > 0; --count) {
+        switch (random() % 9) {
+            case 0: code.emit({ 0xA9, (int)(control ^ (random() & 0x3F)), 0x8D, 0x00, 0x20 }); break;  //PPUCTRL, keeping the NMI
+            case 1: code.emit({ 0xA9, randomMask(), 0x8D, 0x01, 0x20 }); break;                 //PPUMASK
+            case 2: code.emit({ 0xA9, (int)(random() & 0xFF), 0x8D, 0x03, 0x20 }); break;       //OAMADDR
+            case 3: code.emit({ 0xA9, (int)(random() & 0xFF), 0x8D, 0x04, 0x20 }); break;       //OAMDATA
+            case 4: code.emit({ 0xA9, (int)(random() & 0xFF), 0x8D, 0x05, 0x20 }); break;       //PPUSCROLL
+            case 5: code.emit({ 0xA9, (int)(random() & 0xFF), 0x8D, 0x06, 0x20 }); break;       //PPUADDR
+            case 6: code.emit({ 0xA9, (int)(random() & 0xFF), 0x8D, 0x07, 0x20 }); break;       //PPUDATA
+            case 7: code.emit({ 0xAD, 0x07, 0x20 }); break;                                     //LDA $2007
+            default: code.emit({ 0xAD, 0x02, 0x20 }); break;                                    //LDA $2002
+        }
+    }
+    code.emit({ 0x4C, main & 0xFF, main >> 8 });                           //JMP main
+
+    code.address = 0x9000;
+    code.emit({ 0x48, 0xAD, 0x02, 0x20 });                                 //PHA, LDA $2002
+    code.emit({ 0xA9, 0x02, 0x8D, 0x14, 0x40 });                           //OAM DMA from $0200
+    code.emit({ 0xEE, 0x00, 0x02, 0xEE, 0x03, 0x02 });                     //INC $0200, INC $0203
+    code.emit({ 0xA5, 0x11, 0x8D, 0x05, 0x20, 0xE6, 0x11 });               //LDA $11, STA $2005, INC $11
+    code.emit({ 0xA9, (int)(random() & 0xFF), 0x8D, 0x05, 0x20 });         //LDA #y, STA $2005
+    code.emit({ 0xA9, control, 0x8D, 0x00, 0x20 });                        //LDA #control, STA $2000
+    code.emit({ 0x68, 0x40 });                                             //PLA, RTI
+
+    code.address = 0xFFFA;
+    code.emit({ 0x00, 0x90, 0x00, 0x80, 0x00, 0x90 });                     //NMI, reset and IRQ vectors
+}
+
+/**
+* Runs a single program with
+* both renderers.
+*
+* @param filePath path of the
+*   scratch iNES file
+* @param program number of the program
+*
+* @return true if both renderers
+*   ended up in the same state
+*   after every run
+*/
+static bool runProgram(const std::string& filePath, const unsigned int& program) {
+    std::mt19937 random(program);
+    std::vector<Byte> prgRom(32768, 0xEA); //NOPs
+    std::vector<Byte> chrRom(8192);
+    generateProgram(prgRom, random);
+    for (Byte& byte : chrRom) { byte = (Byte)random(); }
+    writeTestRom(filePath, prgRom, chrRom, (Byte)(random() & 1));
+
+    Cartridge scanlineCartridge(filePath);
+    Cartridge dotCartridge(filePath);
+    NullFrontend scanlineFrontend;
+    NullFrontend dotFrontend;
+    NES scanlineNes(scanlineCartridge, &scanlineFrontend);
+    NES dotNes(dotCartridge, &dotFrontend);
+    dotNes.setScanlineRendering(false);
+    const PPU2C02& scanlinePpu = scanlineNes.getPpu();
+    const PPU2C02& dotPpu = dotNes.getPpu();
+
+    unsigned long runs = 0;
+    unsigned long sprite0Hits = 0;
+    unsigned long overflows = 0;
+    while (dotPpu.getFrameCount() < FRAME_COUNT) {
+        unsigned long cycles = random() % MAX_RUN_CYCLES + 1;
+        Frame scanlineFrame = scanlineNes.runCycles(cycles);
+        Frame dotFrame = dotNes.runCycles(cycles);
+        ++runs;
+
+        if (scanlineFrame.hash != dotFrame.hash
+            || scanlinePpu.getStatus() != dotPpu.getStatus()
+            || scanlinePpu.getStateHash() != dotPpu.getStateHash())
+        {
+            std::printf("program %u: the renderers differ after %lu runs in frame %lu: "
+                "FRAME:%016llX/%016llX STATUS:%02X/%02X STATE:%016llX/%016llX\n",
+                program, runs, dotPpu.getFrameCount(),
+                (unsigned long long)scanlineFrame.hash, (unsigned long long)dotFrame.hash,
+                scanlinePpu.getStatus(), dotPpu.getStatus(),
+                (unsigned long long)scanlinePpu.getStateHash(), (unsigned long long)dotPpu.getStateHash());
+            return false;
+        }
+        if (dotPpu.getStatus() & SPRITE_0) { ++sprite0Hits; }
+        if (dotPpu.getStatus() & SPRITE_OVERFLOW) { ++overflows; }
+    }
+
+    std::printf("program %u: %lu runs, sprite 0 hit after %lu, sprite overflow after %lu\n", program, runs, sprite0Hits, overflows);
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+
+    if (argc != 2) {
+        std::printf("Incorrect number of arguments. Usage:\n");
+        std::printf(">./NES_emulator_scanline <scratch iNES filepath>\n\n");
+        return 1;
+    }
+
+    try {
+        bool same = true;
+        for (unsigned int program = 0; program < PROGRAM_COUNT; ++program) {
+            same = runProgram(argv[1], program) && same;
+        }
+        return same ? 0 : 1;
+    } catch (std::exception& error) {
+        std::printf("%s\n\n", error.what());
+        return 1;
+    }
+
+}
@@ -0,0 +1,33 @@
+#ifndef TEST_ROM_H
+#define TEST_ROM_H
+
+#include <cstdint>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+* Writes a mapper 0 iNES file
+* with the given ROM contents.
+* The tests generate their programs
+* and load them like any other game.
+*
+* @param filePath path of the file
+* @param prgRom PRG ROM, a multiple of 16KB
+* @param chrRom CHR ROM, a multiple of 8KB
+* @param flags 6th byte of the header,
+*   e.g. 1 for vertical mirroring
+*/
+inline void writeTestRom(const std::string& filePath, const std::vector<uint8_t>& prgRom, 
+    const std::vector<uint8_t>& chrRom, const uint8_t& flags) 
+{
+    std::ofstream romFile(filePath, std::ios::binary | std::ios::trunc);
+    const char header[16] = { 0x4E, 0x45, 0x53, 0x1A, (char)(prgRom.size() / 16384), (char)(chrRom.size() / 8192), (char)flags };
+    romFile.write(header, sizeof(header));
+    romFile.write((const char*)prgRom.data(), prgRom.size());
+    romFile.write((const char*)chrRom.data(), chrRom.size());
+    if (!romFile) { throw std::runtime_error("Error: Unable to write " + filePath); }
+}
+
+#endif // !TEST_ROM_H